@@ -0,0 +1,32 @@
+/**
+ * @file AAFont.h
+ * @brief Formato de las fuentes proporcionales con suavizado (anti-alias).
+ *
+ * Las tablas se generan con tools/ttf2font.py y se guardan en flash como
+ * constexpr. Cada píxel del glifo es un nivel de cobertura de `bpp` bits
+ * (0 = fondo, máximo = color de texto), empaquetado fila a fila con el bit
+ * más significativo primero y sin relleno entre filas.
+ */
+#pragma once
+#include <Arduino.h>
+
+/** Un glifo dentro de la tabla de bits de la fuente. */
+struct AAGlyph {
+  uint16_t offset;   // Primer byte del glifo en AAFont::bitmap
+  uint8_t width;     // Ancho del recuadro con tinta, en píxeles
+  uint8_t height;    // Alto del recuadro con tinta
+  int8_t xOffset;    // Desde el punto de pluma hasta el borde izquierdo
+  int8_t yOffset;    // Desde la línea base hasta el borde superior (negativo = arriba)
+  uint8_t xAdvance;  // Avance de la pluma tras el glifo
+};
+
+/** Fuente completa: caracteres first..last consecutivos. */
+struct AAFont {
+  const uint8_t* bitmap;
+  const AAGlyph* glyphs;
+  uint8_t first;
+  uint8_t last;
+  uint8_t yAdvance;  // Alto de línea
+  uint8_t ascent;    // Distancia de la parte superior de la línea a la línea base
+  uint8_t bpp;       // Bits de cobertura por píxel: 2 o 4
+};
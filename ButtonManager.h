@@ -22,6 +22,7 @@ public:
     static const uint8_t EVENT_CLICKED = AceButton::kEventClicked;
     static const uint8_t EVENT_DOUBLE_CLICKED = AceButton::kEventDoubleClicked;
     static const uint8_t EVENT_LONG_PRESSED = AceButton::kEventLongPressed;
+    static const uint8_t EVENT_REPEAT_PRESSED = AceButton::kEventRepeatPressed;
 
 private:
     static const uint8_t BUTTON_PIN = 2;
@@ -3,6 +3,15 @@
 
 ConfigManager configManager;
 
+/** Clave NVS de un botón ("b<banco>_btn<índice>"); NVS admite 15 caracteres. */
+typedef StackString<16> NvsKey;
+
+static NvsKey buttonKey(int bank, int index) {
+    NvsKey key("b");
+    key.append(bank).append("_btn").append(index);
+    return key;
+}
+
 // UUIDs for the Service and Characteristics
 #define SERVICE_UUID        "4fafc201-1fb5-459e-8fcc-c5c9c331914b"
 #define COMMAND_CHAR_UUID   "beb5483e-36e1-4688-b7f5-ea07361b26a8"
@@ -43,7 +52,9 @@ void ConfigManager::begin() {
 }
 
 void ConfigManager::update() {
-    // Nothing needed here anymore
+    if (bleStatus.update()) {
+        pedalboardUI.showStatusMessage(bleStatus.front().text.c_str(), bleStatus.front().color);
+    }
 }
 
 void ConfigManager::handleBLECommand(uint8_t* data, size_t len) {
@@ -64,8 +75,9 @@ void ConfigManager::handleBLECommand(uint8_t* data, size_t len) {
         
         saveButtonConfig(index, newConfig);
         
-        String msg = "Saved: B" + String(getCurrentBank() + 1) + " Btn" + String(index + 1);
-        pedalboardUI.showStatusMessage(msg, CYAN);
+        UIText msg("Saved: B");
+        msg.append(getCurrentBank() + 1).append(" Btn").append(index + 1);
+        bleStatus.publish({msg, CYAN});
         
         // Send updated config back
         sendCurrentConfig();
@@ -75,8 +87,7 @@ void ConfigManager::handleBLECommand(uint8_t* data, size_t len) {
         uint8_t bank = index;
         setCurrentBank(bank);
         
-        String msg = "Bank " + String(bank + 1);
-        pedalboardUI.showStatusMessage(msg, MAGENTA);
+        bleStatus.publish({PedalboardUI::bankName(bank), MAGENTA});
         
         // Send new bank config back
         sendCurrentConfig();
@@ -150,7 +161,7 @@ void ConfigManager::loadFromPreferences() {
         preferences.begin("midi-pedal", false);
         for (int b = 0; b < NUM_BANKS; b++) {
             for (int i = 0; i < 4; i++) {
-                String key = "b" + String(b) + "_btn" + String(i);
+                NvsKey key = buttonKey(b, i);
                 if (preferences.isKey(key.c_str())) {
                     preferences.getBytes(key.c_str(), &configs[b][i], sizeof(MidiButtonConfig));
                 } else {
@@ -178,7 +189,7 @@ void ConfigManager::loadDefaults() {
             else if (b == 2) configs[b][i].value = 48 + i;
             else configs[b][i].value = 36 + i;
             
-            String key = "b" + String(b) + "_btn" + String(i);
+            NvsKey key = buttonKey(b, i);
             preferences.putBytes(key.c_str(), &configs[b][i], sizeof(MidiButtonConfig));
         }
     }
@@ -197,7 +208,7 @@ void ConfigManager::saveButtonConfig(uint8_t index, MidiButtonConfig config) {
     configs[currentBank][index] = config;
     
     preferences.begin("midi-pedal", false);
-    String key = "b" + String(currentBank) + "_btn" + String(index);
+    NvsKey key = buttonKey(currentBank, index);
     preferences.putBytes(key.c_str(), &config, sizeof(MidiButtonConfig));
     preferences.end();
     
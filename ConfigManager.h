@@ -7,6 +7,7 @@
 #include <BLEServer.h>
 #include <BLEUtils.h>
 #include <BLE2902.h>
+#include "PedalboardUI.h"
 
 // Button types
 enum ButtonType {
@@ -69,6 +70,10 @@ private:
     BLECharacteristic* pCommandCharacteristic = nullptr;
     BLECharacteristic* pDataCharacteristic = nullptr;
     
+    // Último mensaje de estado de la tarea BLE; update() lo pasa a la UI, que
+    // sólo admite un productor (el loop)
+    LatestValue<UIStatus> bleStatus;
+    
     void loadFromPreferences();
     void setupBLE();
 };
@@ -1,4 +1,7 @@
 #include "Display_ST7789.h"
+#include "driver/spi_master.h"
+#include "driver/gpio.h"
+#include "esp_heap_caps.h"
 
 /**
  * @file Display_ST7789.cpp
@@ -9,30 +12,89 @@
  * Los nombres de pines y configuraciones como SPIFreq, EXAMPLE_PIN_* y HORIZONTAL
  * se definen en el archivo de cabecera o en la configuración del proyecto.
  *
+ * El transporte usa el driver spi_master de ESP-IDF: cada escritura se encola
+ * como un descriptor de transacción y el DMA la envía en segundo plano. Las
+ * funciones de comando/dato son asíncronas salvo que reciban un puntero del
+ * llamador, en cuyo caso esperan a que el bus quede libre antes de volver.
+ *
  * Documentación escrita en español (Doxygen-compatible).
  */
 
 /**
- * Instancia de la clase SPI usada para el LCD.
- * Se construye con el bus FSPI (modo de hardware ESP32/ESP families).
+ * Descriptor de transacción encolado en el bus.
+ * `t.user` apunta a la propia estructura para que los callbacks de ISR
+ * recuperen el nivel de DC y la notificación de fin.
  */
-SPIClass LCDspi(FSPI);
+typedef struct {
+  spi_transaction_t t;
+  uint8_t dc;                     // Nivel de DC durante la transacción
+  int8_t buffer;                  // Índice del buffer de línea referenciado (-1 si ninguno)
+  LCD_TransferDoneCallback done;  // Callback (ISR) al terminar, o NULL
+  void* arg;
+} LCD_Trans;
+
+/** Dispositivo SPI del LCD (bus FSPI / SPI2). */
+static spi_device_handle_t lcdDev = NULL;
+
+/** Anillo de descriptores. Se reciclan en orden porque el bus los completa en orden. */
+static LCD_Trans lcdTrans[LCD_TRANS_QUEUE];
+static uint8_t lcdTransHead = 0;      // Próximo descriptor libre
+static uint8_t lcdTransInFlight = 0;  // Descriptores encolados sin recoger
+
+/** Buffers de línea DMA (doble buffer) y transacciones pendientes sobre cada uno. */
+static uint16_t* lcdLineBuf[2] = {NULL, NULL};
+static uint8_t lcdLinePending[2] = {0, 0};
+static uint8_t lcdLineNext = 0;
+
+/** true mientras CS sigue activo desde el descriptor anterior (SPI_TRANS_CS_KEEP_ACTIVE). */
+static bool lcdCsActive = false;
+
+/** Estadísticas acumuladas del bus (ver LCD_GetStats). */
+static LCD_Stats lcdStats = {0, 0, 0};
+
+/** Fija DC antes de que el hardware empiece a enviar el descriptor. */
+static void IRAM_ATTR LCD_PreTransfer(spi_transaction_t* t) {
+  LCD_Trans* tr = (LCD_Trans*)t->user;
+  gpio_set_level((gpio_num_t)EXAMPLE_PIN_NUM_LCD_DC, tr->dc);
+}
 
-/**
- * Macros de conveniencia para transferencias SPI.
- * SPI_WRITE envía un byte, SPI_WRITE_Word envía 16 bits.
- */
-#define SPI_WRITE(_dat) LCDspi.transfer(_dat)
-#define SPI_WRITE_Word(_dat) LCDspi.transfer16(_dat)
+/** Notifica el fin de un bloque de píxeles, si se pidió callback. */
+static void IRAM_ATTR LCD_PostTransfer(spi_transaction_t* t) {
+  LCD_Trans* tr = (LCD_Trans*)t->user;
+  if (tr->done) tr->done(tr->arg);
+}
 
 /**
  * @brief Inicializa la interfaz SPI para el LCD.
  *
- * Configura los pines SCLK, MISO y MOSI usados por la instancia SPI. Los
- * identificadores de pin se toman de las constantes EXAMPLE_PIN_NUM_*.
+ * Registra el bus FSPI con DMA automático y añade el LCD como único
+ * dispositivo. El bus queda adquirido de forma permanente para poder
+ * mantener CS activo entre descriptores de una misma ventana.
  */
 void SPI_Init() {
-  LCDspi.begin(EXAMPLE_PIN_NUM_SCLK, EXAMPLE_PIN_NUM_MISO, EXAMPLE_PIN_NUM_MOSI);
+  spi_bus_config_t bus = {};
+  bus.mosi_io_num = EXAMPLE_PIN_NUM_MOSI;
+  bus.miso_io_num = EXAMPLE_PIN_NUM_MISO;
+  bus.sclk_io_num = EXAMPLE_PIN_NUM_SCLK;
+  bus.quadwp_io_num = -1;
+  bus.quadhd_io_num = -1;
+  bus.max_transfer_sz = LCD_DMA_BUFFER_PIXELS * sizeof(uint16_t);
+  spi_bus_initialize(SPI2_HOST, &bus, SPI_DMA_CH_AUTO);
+
+  spi_device_interface_config_t dev = {};
+  dev.clock_speed_hz = SPIFreq;
+  dev.mode = 0;
+  dev.spics_io_num = EXAMPLE_PIN_NUM_LCD_CS;
+  dev.queue_size = LCD_TRANS_QUEUE;
+  dev.flags = SPI_DEVICE_NO_DUMMY;
+  dev.pre_cb = LCD_PreTransfer;
+  dev.post_cb = LCD_PostTransfer;
+  spi_bus_add_device(SPI2_HOST, &dev, &lcdDev);
+  spi_device_acquire_bus(lcdDev, portMAX_DELAY);
+
+  for (int i = 0; i < 2; i++) {
+    lcdLineBuf[i] = (uint16_t*)heap_caps_malloc(LCD_DMA_BUFFER_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+  }
 }
 
 // Offsets y orientación en tiempo de ejecución (antes eran macros)
@@ -41,6 +103,9 @@ int Offset_X = OFFSET_X_VERT;
 int Offset_Y = OFFSET_Y_VERT;
 uint8_t CurrentOrientation = ORIENTATION; // valor por defecto (desde Display_Config.h)
 
+/** true si MADCTL invierte el orden de las líneas de barrido (bit MY). */
+static bool lcdScanMirrored = false;
+
 /**
  * @brief Ajusta la orientación del display en tiempo de ejecución.
  *
@@ -53,31 +118,120 @@ void SetOrientation(uint8_t orient) {
   if (orient == HORIZONTAL) {
     // Para horizontal usar MADCTL = 0xA0 según preferencia del usuario
     LCD_WriteData(0xA0);
+    lcdScanMirrored = true;
     Offset_X = OFFSET_X_HORIZ;
     Offset_Y = OFFSET_Y_HORIZ;
   } else {
     // Para vertical usar MADCTL = 0x20
     LCD_WriteData(0x20);
+    lcdScanMirrored = false;
     Offset_X = OFFSET_X_VERT;
     Offset_Y = OFFSET_Y_VERT;
   }
 }
 
+/**
+ * @brief Recoge el descriptor más antiguo (bloquea hasta que termine).
+ *
+ * Libera su referencia sobre el buffer de línea, si la tenía.
+ */
+static void LCD_ReclaimOne() {
+  spi_transaction_t* done;
+  spi_device_get_trans_result(lcdDev, &done, portMAX_DELAY);
+  LCD_Trans* tr = (LCD_Trans*)done->user;
+  if (tr->buffer >= 0) lcdLinePending[tr->buffer]--;
+  lcdTransInFlight--;
+}
+
+/**
+ * @brief Encola una transacción de comando o datos.
+ *
+ * Hasta 4 bytes se copian en el propio descriptor; bloques mayores se envían
+ * por DMA desde Data, que debe seguir siendo válido hasta que se complete.
+ *
+ * @param Dc     Nivel de DC (LOW = comando, HIGH = dato).
+ * @param Data   Bytes a enviar.
+ * @param Len    Número de bytes.
+ * @param KeepCs Mantener CS activo tras este descriptor.
+ * @param Buffer Índice del buffer de línea referenciado (-1 si ninguno).
+ * @param Done   Callback al completarse (NULL si ninguno).
+ * @param Arg    Argumento para Done.
+ */
+static void LCD_Queue(uint8_t Dc, const uint8_t* Data, uint32_t Len, bool KeepCs,
+                      int8_t Buffer, LCD_TransferDoneCallback Done, void* Arg) {
+  if (lcdTransInFlight == LCD_TRANS_QUEUE) LCD_ReclaimOne();
+
+  LCD_Trans* tr = &lcdTrans[lcdTransHead];
+  lcdTransHead = (lcdTransHead + 1) % LCD_TRANS_QUEUE;
+
+  memset(&tr->t, 0, sizeof(tr->t));
+  tr->t.length = Len * 8;
+  tr->t.user = tr;
+  if (Len <= 4) {
+    tr->t.flags = SPI_TRANS_USE_TXDATA;
+    memcpy(tr->t.tx_data, Data, Len);
+  } else {
+    tr->t.tx_buffer = Data;
+  }
+  if (KeepCs) tr->t.flags |= SPI_TRANS_CS_KEEP_ACTIVE;
+  tr->dc = Dc;
+  tr->buffer = Buffer;
+  tr->done = Done;
+  tr->arg = Arg;
+
+  if (Buffer >= 0) lcdLinePending[Buffer]++;
+  if (!lcdCsActive) lcdStats.transactions++;
+  lcdCsActive = KeepCs;
+  lcdStats.bytes += Len;
+
+  spi_device_queue_trans(lcdDev, &tr->t, portMAX_DELAY);
+  lcdTransInFlight++;
+}
+
+/**
+ * @brief Encola un flujo de comandos.
+ *
+ * Cada registro del flujo es: comando, cantidad de datos N y N bytes de datos.
+ * Todos los descriptores comparten CS; el último lo libera salvo que KeepCs
+ * sea true (p.ej. RAMWR seguido de píxeles).
+ *
+ * @return true si algún registro referencia bytes de Stream (más de 4 datos),
+ *         en cuyo caso Stream debe seguir vivo hasta que el bus quede libre.
+ */
+static bool LCD_QueueCommandStream(const uint8_t* Stream, uint32_t Len, bool KeepCs) {
+  bool borrowed = false;
+  uint32_t i = 0;
+  while (i + 1 < Len) {
+    uint8_t cmd = Stream[i];
+    uint8_t n = Stream[i + 1];
+    bool last = (i + 2 + n) >= Len;
+    LCD_Queue(LOW, &cmd, 1, n > 0 || !last || KeepCs, -1, NULL, NULL);
+    if (n > 0) {
+      LCD_Queue(HIGH, &Stream[i + 2], n, !last || KeepCs, -1, NULL, NULL);
+      if (n > 4) borrowed = true;
+    }
+    i += 2 + n;
+  }
+  return borrowed;
+}
+
+/**
+ * @brief Espera a que el bus termine todas las transacciones encoladas.
+ */
+void LCD_WaitIdle(void) {
+  while (lcdTransInFlight > 0) LCD_ReclaimOne();
+}
+
 /**
  * @brief Envía un comando al controlador ST7789.
  *
  * El pin DC se pone en bajo para indicar que lo enviado es un comando.
- * La función abre una transacción SPI con las configuraciones definidas en SPIFreq.
+ * La transacción se encola y la función vuelve sin esperar al bus.
  *
  * @param Cmd Byte que contiene el comando a enviar.
  */
 void LCD_WriteCommand(uint8_t Cmd) {
-  LCDspi.beginTransaction(SPISettings(SPIFreq, MSBFIRST, SPI_MODE0));
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_CS, LOW);
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_DC, LOW);
-  SPI_WRITE(Cmd);
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_CS, HIGH);
-  LCDspi.endTransaction();
+  LCD_Queue(LOW, &Cmd, 1, false, -1, NULL, NULL);
 }
 
 /**
@@ -88,12 +242,7 @@ void LCD_WriteCommand(uint8_t Cmd) {
  * @param Data Byte de datos a enviar.
  */
 void LCD_WriteData(uint8_t Data) {
-  LCDspi.beginTransaction(SPISettings(SPIFreq, MSBFIRST, SPI_MODE0));
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_CS, LOW);
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_DC, HIGH);
-  SPI_WRITE(Data);
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_CS, HIGH);
-  LCDspi.endTransaction();
+  LCD_Queue(HIGH, &Data, 1, false, -1, NULL, NULL);
 }
 
 /**
@@ -101,174 +250,253 @@ void LCD_WriteData(uint8_t Data) {
  *
  * Utilizado habitualmente para escritura de píxeles en modo palabra.
  *
- * @param Data Valor de 16 bits a enviar.
+ * @param Data Valor de 16 bits a enviar (byte alto primero).
  */
 void LCD_WriteData_Word(uint16_t Data) {
-  LCDspi.beginTransaction(SPISettings(SPIFreq, MSBFIRST, SPI_MODE0));
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_CS, LOW);
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_DC, HIGH);
-  SPI_WRITE_Word(Data);
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_CS, HIGH);
-  LCDspi.endTransaction();
+  uint8_t bytes[2] = {(uint8_t)(Data >> 8), (uint8_t)(Data & 0xFF)};
+  LCD_Queue(HIGH, bytes, 2, false, -1, NULL, NULL);
 }
 
 /**
- * @brief Transferencia de múltiples bytes por SPI (lectura/escritura simultánea).
+ * @brief Transferencia de múltiples bytes por SPI (sólo escritura).
  *
- * Esta función usa transferBytes para enviar un bloque de datos y opcionalmente
- * leer la respuesta en ReadData.
+ * El bus no tiene MISO, así que ReadData se ignora. Espera a que el bloque
+ * termine de enviarse porque SetData pertenece al llamador.
  *
  * @param SetData Puntero al buffer de datos a enviar.
- * @param ReadData Puntero al buffer donde almacenar datos leídos (puede ser NULL si no se requiere lectura).
+ * @param ReadData No se usa (puede ser NULL).
  * @param Size Número de bytes a transferir.
  */
 void LCD_WriteData_nbyte(uint8_t* SetData, uint8_t* ReadData, uint32_t Size) {
-  LCDspi.beginTransaction(SPISettings(SPIFreq, MSBFIRST, SPI_MODE0));
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_CS, LOW);
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_DC, HIGH);
-  LCDspi.transferBytes(SetData, ReadData, Size);
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_CS, HIGH);
-  LCDspi.endTransaction();
+  (void)ReadData;
+  const uint32_t chunk = LCD_DMA_BUFFER_PIXELS * sizeof(uint16_t);
+  for (uint32_t off = 0; off < Size; off += chunk) {
+    uint32_t n = (Size - off < chunk) ? Size - off : chunk;
+    LCD_Queue(HIGH, SetData + off, n, off + n < Size, -1, NULL, NULL);
+  }
+  LCD_WaitIdle();
 }
 
 /**
- * @brief Reinicia el display mediante los pines de control.
+ * @brief Envía un flujo de comandos completo bajo una sola aserción de CS.
  *
- * Realiza una secuencia de pulsos en los pines CS y RST con pequeños delays
- * para asegurar el reset correcto del controlador.
+ * @param Stream Flujo codificado como registros {comando, N, datos[N]}.
+ * @param Len    Longitud total del flujo en bytes.
  */
-void LCD_Reset(void) {
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_CS, LOW);
-  delay(50);
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_RST, LOW);
-  delay(50);
-  digitalWrite(EXAMPLE_PIN_NUM_LCD_RST, HIGH);
-  delay(50);
+void LCD_WriteCommandStream(const uint8_t* Stream, uint32_t Len) {
+  if (LCD_QueueCommandStream(Stream, Len, false)) LCD_WaitIdle();
 }
 
 /**
- * @brief Inicializa el controlador ST7789 y configura el display.
+ * @brief Codifica CASET/RASET/RAMWR para una ventana como flujo de comandos.
+ *
+ * Aplica el intercambio de ejes según la orientación y los offsets
+ * Offset_X / Offset_Y. El flujo resultante ocupa LCD_WINDOW_STREAM_LEN bytes.
  *
- * Configura los pines como salidas, inicializa la retroiluminación, SPI y
- * envía la secuencia de comandos recomendada para poner el display en modo
- * operativo. Los valores y comandos usados siguen la hoja de datos del ST7789.
+ * @param Out    Buffer destino (al menos LCD_WINDOW_STREAM_LEN bytes).
+ * @param Xstart Coordenada X inicial (pixel).
+ * @param Ystart Coordenada Y inicial (pixel).
+ * @param Xend   Coordenada X final (pixel).
+ * @param Yend   Coordenada Y final (pixel).
+ * @return Número de bytes escritos en Out.
  */
-void LCD_Init(void) {
-  pinMode(EXAMPLE_PIN_NUM_LCD_CS, OUTPUT);
-  pinMode(EXAMPLE_PIN_NUM_LCD_DC, OUTPUT);
-  pinMode(EXAMPLE_PIN_NUM_LCD_RST, OUTPUT);
-  Backlight_Init();
-  SPI_Init();
-
-  LCD_Reset();
-  //************* Start Initial Sequence **********//
-  // 0x11: Sleep OUT — despierta el controlador del estado de sueño
-  LCD_WriteCommand(0x11);
-  delay(120);
-
-  // Configurar orientación por defecto usando la función runtime
-  LCD_WriteCommand(0x36); // MADCTL será escrito por SetOrientation
-  SetOrientation(CurrentOrientation);
-
-  // 0x3A: Interface Pixel Format
-  // 0x05 = 16 bits/píxel (RGB565). Es el formato usado por el resto del código.
-  LCD_WriteCommand(0x3A);
-  LCD_WriteData(0x05);
+uint32_t LCD_EncodeWindow(uint8_t* Out, uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend) {
+  uint16_t c0, c1, r0, r1;
+  if (CurrentOrientation == HORIZONTAL) {
+    c0 = Xstart + Offset_X;
+    c1 = Xend + Offset_X;
+    r0 = Ystart + Offset_Y;
+    r1 = Yend + Offset_Y;
+  } else {
+    c0 = Ystart + Offset_Y;
+    c1 = Yend + Offset_Y;
+    r0 = Xstart + Offset_X;
+    r1 = Xend + Offset_X;
+  }
+  uint8_t* p = Out;
+  // 0x2A: CASET
+  *p++ = 0x2A; *p++ = 4;
+  *p++ = c0 >> 8; *p++ = c0 & 0xFF; *p++ = c1 >> 8; *p++ = c1 & 0xFF;
+  // 0x2B: RASET
+  *p++ = 0x2B; *p++ = 4;
+  *p++ = r0 >> 8; *p++ = r0 & 0xFF; *p++ = r1 >> 8; *p++ = r1 & 0xFF;
+  // 0x2C: RAMWR (los píxeles siguen como datos)
+  *p++ = 0x2C; *p++ = 0;
+  return p - Out;
+}
 
-  // Comandos B0/B2/B7/BB: configuración de modos de panel, porches y timings
-  // Estos valores son típicos para módulos ST7789 y ajustan parámetros internos
-  // como frecuencia de cuadro, porches front/back y funciones específicas del panel.
-  LCD_WriteCommand(0xB0);
-  LCD_WriteData(0x00);
-  LCD_WriteData(0xE8);
+/** @brief Devuelve las estadísticas acumuladas del bus SPI. */
+LCD_Stats LCD_GetStats(void) {
+  return lcdStats;
+}
 
-  LCD_WriteCommand(0xB2);
-  LCD_WriteData(0x0C);
-  LCD_WriteData(0x0C);
-  LCD_WriteData(0x00);
-  LCD_WriteData(0x33);
-  LCD_WriteData(0x33);
+/** @brief Pone a cero las estadísticas del bus SPI. */
+void LCD_ResetStats(void) {
+  lcdStats.transactions = 0;
+  lcdStats.bytes = 0;
+  lcdStats.windows = 0;
+}
 
-  LCD_WriteCommand(0xB7);
-  LCD_WriteData(0x35);
+/**
+ * @brief Secuencia de arranque del ST7789.
+ *
+ * Registros {comando, N, datos[N]}; si N lleva LCD_CMD_DELAY, tras los datos
+ * sigue un byte con la espera mínima en ms antes del siguiente comando.
+ * MADCTL no está aquí: depende de la orientación y lo escribe SetOrientation.
+ */
+static constexpr uint8_t LCD_INIT_SEQUENCE[] = {
+  // 0x11: Sleep OUT — la hoja de datos pide 5 ms antes del siguiente comando
+  0x11, 0 | LCD_CMD_DELAY, 5,
+  // 0x3A: Interface Pixel Format — 0x05 = 16 bits/píxel (RGB565)
+  0x3A, 1, 0x05,
+  // B0/B2/B7/BB: modos de panel, porches y timings típicos de módulos ST7789
+  0xB0, 2, 0x00, 0xE8,
+  0xB2, 5, 0x0C, 0x0C, 0x00, 0x33, 0x33,
+  0xB7, 1, 0x35,
+  0xBB, 1, 0x35,
+  // Cx: control de voltajes y ajustes de driving (vcom, etc.)
+  0xC0, 1, 0x2C,
+  0xC2, 1, 0x01,
+  0xC3, 1, 0x13,
+  0xC4, 1, 0x20,
+  0xC6, 1, 0x0F,
+  // D0/D6: power control / VGH/VGL según el panel
+  0xD0, 2, 0xA4, 0xA1,
+  0xD6, 1, 0xA1,
+  // E0 / E1: tablas de corrección de gamma (positive / negative)
+  0xE0, 14, 0xF0, 0x00, 0x04, 0x04, 0x04, 0x05, 0x29, 0x33, 0x3E, 0x38, 0x12, 0x12, 0x28, 0x30,
+  0xE1, 14, 0xF0, 0x07, 0x0A, 0x0D, 0x0B, 0x07, 0x28, 0x33, 0x3E, 0x36, 0x14, 0x14, 0x29, 0x32,
+  // 0x21: Display Inversion ON — mejora uniformidad/contraste para algunos paneles
+  0x21, 0,
+  // 0x29: DISPLAY ON
+  0x29, 0,
+};
 
-  LCD_WriteCommand(0xBB);
-  LCD_WriteData(0x35);
+/**
+ * @brief Comprueba en compilación que una secuencia está bien formada.
+ *
+ * Cada registro debe caber completo (comando, N, datos y, si procede, el
+ * byte de espera) y la secuencia debe terminar exactamente en un límite.
+ */
+static constexpr bool LCD_SequenceIsValid(const uint8_t* Seq, uint32_t Len) {
+  uint32_t i = 0;
+  while (i < Len) {
+    if (i + 2 > Len) return false;
+    uint8_t n = Seq[i + 1] & ~LCD_CMD_DELAY;
+    i += 2 + n + ((Seq[i + 1] & LCD_CMD_DELAY) ? 1 : 0);
+  }
+  return i == Len;
+}
+static_assert(LCD_SequenceIsValid(LCD_INIT_SEQUENCE, sizeof(LCD_INIT_SEQUENCE)),
+              "LCD_INIT_SEQUENCE mal formada");
 
-  // Comandos Cx: control de voltajes y ajustes de driving (vcom, gammas, etc.)
-  LCD_WriteCommand(0xC0);
-  LCD_WriteData(0x2C);
+/** Tiempo mínimo entre soltar RST y enviar Sleep OUT (peor caso: panel ya despierto). */
+#define LCD_RESET_SETTLE_MS 120
 
-  LCD_WriteCommand(0xC2);
-  LCD_WriteData(0x01);
+// Estado del arranque incremental (LCD_InitStart / LCD_InitPoll)
+static uint32_t lcdInitPos = 0;       // Próximo registro de LCD_INIT_SEQUENCE
+static uint32_t lcdInitReadyAt = 0;   // millis() a partir del cual se puede seguir
+static bool lcdInitDone = false;
 
-  LCD_WriteCommand(0xC3);
-  LCD_WriteData(0x13);
+/** Suelta el pulso de reset por hardware (RST bajo ≥10 µs). */
+static void LCD_PulseReset() {
+  LCD_WaitIdle();
+  digitalWrite(EXAMPLE_PIN_NUM_LCD_RST, LOW);
+  delayMicroseconds(20);
+  digitalWrite(EXAMPLE_PIN_NUM_LCD_RST, HIGH);
+}
 
-  LCD_WriteCommand(0xC4);
-  LCD_WriteData(0x20);
+/**
+ * @brief Reinicia el display mediante los pines de control.
+ *
+ * Espera a que el bus quede libre, da un pulso en RST y espera el tiempo
+ * que la hoja de datos exige antes de volver a enviar comandos.
+ */
+void LCD_Reset(void) {
+  LCD_PulseReset();
+  delay(LCD_RESET_SETTLE_MS);
+}
 
-  LCD_WriteCommand(0xC6);
-  LCD_WriteData(0x0F);
+/**
+ * @brief Comienza la inicialización del controlador sin bloquear.
+ *
+ * Configura pines, retroiluminación y SPI, da el pulso de reset y vuelve de
+ * inmediato. La espera posterior al reset corre en paralelo con lo que haga
+ * el llamador (NVS, BLE...); completar con LCD_InitPoll o LCD_InitFinish.
+ */
+void LCD_InitStart(void) {
+  pinMode(EXAMPLE_PIN_NUM_LCD_DC, OUTPUT);
+  pinMode(EXAMPLE_PIN_NUM_LCD_RST, OUTPUT);
+  Backlight_Init();
+  if (lcdDev == NULL) SPI_Init();
 
-  // D0/D6: ajustes de power control / VGH/VGL según el panel
-  LCD_WriteCommand(0xD0);
-  LCD_WriteData(0xA4);
-  LCD_WriteData(0xA1);
+  LCD_PulseReset();
+  lcdInitReadyAt = millis() + LCD_RESET_SETTLE_MS;
+  lcdInitPos = 0;
+  lcdInitDone = false;
+}
 
-  LCD_WriteCommand(0xD6);
-  LCD_WriteData(0xA1);
+/**
+ * @brief Avanza la secuencia de arranque sin bloquear.
+ *
+ * Si ya pasó la espera pendiente, encola los registros de LCD_INIT_SEQUENCE
+ * (compartiendo CS) hasta la siguiente marca de espera o el final.
+ *
+ * @return true cuando el display está listo para recibir píxeles.
+ */
+bool LCD_InitPoll(void) {
+  if (lcdInitDone) return true;
+  if ((int32_t)(millis() - lcdInitReadyAt) < 0) return false;
+
+  const uint8_t* seq = LCD_INIT_SEQUENCE;
+  const uint32_t len = sizeof(LCD_INIT_SEQUENCE);
+  while (lcdInitPos < len) {
+    uint8_t cmd = seq[lcdInitPos];
+    uint8_t n = seq[lcdInitPos + 1] & ~LCD_CMD_DELAY;
+    bool wait = seq[lcdInitPos + 1] & LCD_CMD_DELAY;
+    const uint8_t* data = &seq[lcdInitPos + 2];
+    lcdInitPos += 2 + n + (wait ? 1 : 0);
+    bool last = wait || lcdInitPos >= len;
+
+    LCD_Queue(LOW, &cmd, 1, n > 0 || !last, -1, NULL, NULL);
+    if (n > 0) LCD_Queue(HIGH, data, n, !last, -1, NULL, NULL);
+
+    if (wait) {
+      LCD_WaitIdle();
+      lcdInitReadyAt = millis() + data[n];
+      return false;
+    }
+  }
 
-  // E0 / E1: tablas de corrección de gamma (positive / negative)
-  // Los múltiples bytes a continuación configuran la curva de gamma para
-  // mejorar contraste y reproducción tonal del panel.
-  LCD_WriteCommand(0xE0);
-  LCD_WriteData(0xF0);
-  LCD_WriteData(0x00);
-  LCD_WriteData(0x04);
-  LCD_WriteData(0x04);
-  LCD_WriteData(0x04);
-  LCD_WriteData(0x05);
-  LCD_WriteData(0x29);
-  LCD_WriteData(0x33);
-  LCD_WriteData(0x3E);
-  LCD_WriteData(0x38);
-  LCD_WriteData(0x12);
-  LCD_WriteData(0x12);
-  LCD_WriteData(0x28);
-  LCD_WriteData(0x30);
-
-  LCD_WriteCommand(0xE1);
-  LCD_WriteData(0xF0);
-  LCD_WriteData(0x07);
-  LCD_WriteData(0x0A);
-  LCD_WriteData(0x0D);
-  LCD_WriteData(0x0B);
-  LCD_WriteData(0x07);
-  LCD_WriteData(0x28);
-  LCD_WriteData(0x33);
-  LCD_WriteData(0x3E);
-  LCD_WriteData(0x36);
-  LCD_WriteData(0x14);
-  LCD_WriteData(0x14);
-  LCD_WriteData(0x29);
-  LCD_WriteData(0x32);
+  SetOrientation(CurrentOrientation);
+  LCD_WaitIdle();
+  lcdInitDone = true;
+  return true;
+}
 
-  // 0x21: Display Inversion ON — mejora uniformidad/contraste para algunos paneles
-  LCD_WriteCommand(0x21);
+/** @brief Completa la inicialización, esperando sólo lo que quede de cada pausa. */
+void LCD_InitFinish(void) {
+  while (!LCD_InitPoll()) {
+    int32_t remaining = (int32_t)(lcdInitReadyAt - millis());
+    if (remaining > 0) delay(remaining);
+  }
+}
 
-  // Re-send Sleep OUT / Display ON sequence: asegurar que el controlador salga
-  // del modo sleep y que la pantalla quede activada.
-  LCD_WriteCommand(0x11);
-  delay(120);
-  LCD_WriteCommand(0x29); // 0x29: DISPLAY ON
+/**
+ * @brief Inicializa el controlador ST7789 y configura el display.
+ *
+ * Versión bloqueante: equivale a LCD_InitStart() seguido de LCD_InitFinish().
+ */
+void LCD_Init(void) {
+  LCD_InitStart();
+  LCD_InitFinish();
 }
 /******************************************************************************/
 /**
  * @brief Coloca el cursor (ventana de escritura) en el display.
  *
- * Según la orientación (HORIZONTAL) intercambia las coordenadas X/Y y aplica
- * offsets definidos en Offset_X / Offset_Y.
+ * Envía CASET/RASET/RAMWR como un único flujo de comandos bajo una sola
+ * aserción de CS (ver LCD_EncodeWindow).
  *
  * @param Xstart Coordenada X inicial (pixel).
  * @param Ystart Coordenada Y inicial (pixel).
@@ -276,62 +504,288 @@ void LCD_Init(void) {
  * @param Yend   Coordenada Y final (pixel).
  */
 void LCD_SetCursor(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend) {
-  if (CurrentOrientation == HORIZONTAL) {
-    // set the X coordinates
-    LCD_WriteCommand(0x2A);
-    LCD_WriteData(Xstart >> 8);
-    LCD_WriteData(Xstart + Offset_X);
-    LCD_WriteData(Xend >> 8);
-    LCD_WriteData(Xend + Offset_X);
-
-    // set the Y coordinates
-    LCD_WriteCommand(0x2B);
-    LCD_WriteData(Ystart >> 8);
-    LCD_WriteData(Ystart + Offset_Y);
-    LCD_WriteData(Yend >> 8);
-    LCD_WriteData(Yend + Offset_Y);
-  } else {
-    // set the X coordinates
-    LCD_WriteCommand(0x2A);
-    LCD_WriteData(Ystart >> 8);
-    LCD_WriteData(Ystart + Offset_Y);
-    LCD_WriteData(Yend >> 8);
-    LCD_WriteData(Yend + Offset_Y);
-    // set the Y coordinates
-    LCD_WriteCommand(0x2B);
-    LCD_WriteData(Xstart >> 8);
-    LCD_WriteData(Xstart + Offset_X);
-    LCD_WriteData(Xend >> 8);
-    LCD_WriteData(Xend + Offset_X);
+  uint8_t stream[LCD_WINDOW_STREAM_LEN];
+  uint32_t len = LCD_EncodeWindow(stream, Xstart, Ystart, Xend, Yend);
+  lcdStats.windows++;
+  LCD_WriteCommandStream(stream, len);
+}
+/******************************************************************************/
+/**
+ * @brief Encola una ventana y su bloque de píxeles sin esperar al bus.
+ *
+ * La ventana y los píxeles comparten una sola aserción de CS. Si Buffer es
+ * uno de los buffers de línea (LCD_AcquireLineBuffer) queda reservado hasta
+ * que el DMA termine; cualquier otro buffer debe ser apto para DMA y seguir
+ * vivo hasta que se invoque Done o se llame a LCD_WaitIdle().
+ *
+ * @param Xstart Coordenada X inicial (pixel).
+ * @param Ystart Coordenada Y inicial (pixel).
+ * @param Xend   Coordenada X final (pixel).
+ * @param Yend   Coordenada Y final (pixel).
+ * @param Buffer Colores RGB565 de la ventana (como mucho LCD_DMA_BUFFER_PIXELS).
+ * @param Done   Callback desde ISR al terminar el envío (puede ser NULL).
+ * @param Arg    Argumento para Done.
+ */
+void LCD_QueueWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend,
+                     uint16_t* Buffer, LCD_TransferDoneCallback Done, void* Arg) {
+  uint32_t numBytes = (uint32_t)(Xend - Xstart + 1) * (Yend - Ystart + 1) * sizeof(uint16_t);
+  int8_t index = -1;
+  if (Buffer == lcdLineBuf[0]) index = 0;
+  else if (Buffer == lcdLineBuf[1]) index = 1;
+
+  uint8_t stream[LCD_WINDOW_STREAM_LEN];
+  uint32_t len = LCD_EncodeWindow(stream, Xstart, Ystart, Xend, Yend);
+  lcdStats.windows++;
+  LCD_QueueCommandStream(stream, len, true);
+  LCD_Queue(HIGH, (const uint8_t*)Buffer, numBytes, false, index, Done, Arg);
+}
+
+/**
+ * @brief Devuelve el siguiente buffer de línea DMA libre.
+ *
+ * Alterna entre los dos buffers: mientras uno viaja por el bus, el llamador
+ * rellena el otro. Sólo bloquea si el buffer pedido sigue en vuelo.
+ *
+ * @return Buffer de LCD_DMA_BUFFER_PIXELS colores.
+ */
+uint16_t* LCD_AcquireLineBuffer(void) {
+  uint8_t i = lcdLineNext;
+  lcdLineNext ^= 1;
+  while (lcdLinePending[i] > 0) LCD_ReclaimOne();
+  return lcdLineBuf[i];
+}
+/******************************************************************************/
+/*
+ * Sumidero de píxeles en flujo.
+ *
+ * LCD_BeginWindow abre una ventana y los píxeles se van acumulando en el
+ * buffer de línea actual; cuando se llena se encola por DMA y se continúa en
+ * el otro buffer. La cabecera CASET/RASET/RAMWR se encola junto con el primer
+ * bloque, así una ventana vacía no genera tráfico. CS se mantiene activo
+ * desde la cabecera hasta el último bloque, que se envía en LCD_EndWindow.
+ */
+static bool lcdStreamOpen = false;
+static bool lcdStreamHeaderSent = false;
+static uint8_t lcdStreamHeader[LCD_WINDOW_STREAM_LEN];
+static uint32_t lcdStreamHeaderLen = 0;
+static int8_t lcdStreamIdx = -1;   // Buffer de línea en curso
+static uint32_t lcdStreamFill = 0; // Píxeles acumulados en el buffer en curso
+
+/** Encola el buffer en curso (y la cabecera de la ventana si aún no salió). */
+static void LCD_StreamFlush(bool KeepCs) {
+  if (lcdStreamFill == 0) return;
+  if (!lcdStreamHeaderSent) {
+    LCD_QueueCommandStream(lcdStreamHeader, lcdStreamHeaderLen, true);
+    lcdStreamHeaderSent = true;
   }
-  LCD_WriteCommand(0x2C);
+  LCD_Queue(HIGH, (const uint8_t*)lcdLineBuf[lcdStreamIdx], lcdStreamFill * sizeof(uint16_t),
+            KeepCs, lcdStreamIdx, NULL, NULL);
+  lcdStreamFill = 0;
+  lcdStreamIdx = -1;
+}
+
+/** true si el buffer en curso admite más píxeles (no está lleno ni compartido con bloques en vuelo). */
+static bool LCD_StreamHasSpace() {
+  return lcdStreamIdx >= 0 && lcdStreamFill < LCD_DMA_BUFFER_PIXELS && lcdLinePending[lcdStreamIdx] == 0;
+}
+
+/** Garantiza un buffer en curso con espacio libre; encola el anterior si hace falta. */
+static void LCD_StreamEnsureSpace() {
+  if (LCD_StreamHasSpace()) return;
+  LCD_StreamFlush(true);
+  uint16_t* buf = LCD_AcquireLineBuffer();
+  lcdStreamIdx = (buf == lcdLineBuf[0]) ? 0 : 1;
+  lcdStreamFill = 0;
+}
+
+/**
+ * @brief Abre una ventana para escritura en flujo.
+ *
+ * Los píxeles se envían fila a fila, de izquierda a derecha, con
+ * LCD_PushPixels / LCD_PushColor / LCD_StreamReserve. No mezclar con otras
+ * escrituras al LCD hasta llamar a LCD_EndWindow.
+ */
+void LCD_BeginWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend) {
+  if (lcdStreamOpen) LCD_EndWindow();
+  lcdStreamHeaderLen = LCD_EncodeWindow(lcdStreamHeader, Xstart, Ystart, Xend, Yend);
+  lcdStreamHeaderSent = false;
+  lcdStreamOpen = true;
+  lcdStats.windows++;
+}
+
+/**
+ * @brief Añade un tramo de píxeles a la ventana abierta.
+ *
+ * Los colores se copian al buffer de línea, así que Pixels puede reutilizarse
+ * en cuanto la función vuelve.
+ */
+void LCD_PushPixels(const uint16_t* Pixels, uint32_t Count) {
+  while (Count > 0) {
+    LCD_StreamEnsureSpace();
+    uint32_t n = LCD_DMA_BUFFER_PIXELS - lcdStreamFill;
+    if (n > Count) n = Count;
+    memcpy(lcdLineBuf[lcdStreamIdx] + lcdStreamFill, Pixels, n * sizeof(uint16_t));
+    lcdStreamFill += n;
+    Pixels += n;
+    Count -= n;
+  }
+}
+
+/**
+ * @brief Añade un tramo de colores RGB565 nativos a la ventana abierta.
+ *
+ * Igual que LCD_PushPixels, pero el intercambio de bytes se hace al copiar al
+ * buffer de línea (dos píxeles por palabra), sin pasada extra.
+ */
+void LCD_PushRGB565(const uint16_t* Pixels, uint32_t Count) {
+  while (Count > 0) {
+    LCD_StreamEnsureSpace();
+    uint32_t n = LCD_DMA_BUFFER_PIXELS - lcdStreamFill;
+    if (n > Count) n = Count;
+    rgb565SwapPixels(lcdLineBuf[lcdStreamIdx] + lcdStreamFill, Pixels, n);
+    lcdStreamFill += n;
+    Pixels += n;
+    Count -= n;
+  }
+}
+
+/**
+ * @brief Añade Count repeticiones de un color a la ventana abierta.
+ *
+ * Para tramos largos el buffer se rellena una sola vez y se encola varias
+ * veces: el coste de CPU no crece con el tamaño de la ventana.
+ */
+void LCD_PushColor(PanelColor Color, uint32_t Count) {
+  // Completar primero el buffer en curso si ya tiene píxeles
+  if (lcdStreamFill > 0 && LCD_StreamHasSpace()) {
+    uint32_t n = LCD_DMA_BUFFER_PIXELS - lcdStreamFill;
+    if (n > Count) n = Count;
+    uint16_t* p = lcdLineBuf[lcdStreamIdx] + lcdStreamFill;
+    for (uint32_t i = 0; i < n; i++) p[i] = Color.raw;
+    lcdStreamFill += n;
+    Count -= n;
+  }
+  if (Count == 0) return;
+
+  LCD_StreamEnsureSpace();
+  uint32_t pattern = (Count < LCD_DMA_BUFFER_PIXELS) ? Count : LCD_DMA_BUFFER_PIXELS;
+  uint16_t* p = lcdLineBuf[lcdStreamIdx];
+  for (uint32_t i = 0; i < pattern; i++) p[i] = Color.raw;
+
+  // Bloques completos: el mismo buffer se encola repetidas veces
+  while (Count > LCD_DMA_BUFFER_PIXELS) {
+    lcdStreamFill = LCD_DMA_BUFFER_PIXELS;
+    int8_t idx = lcdStreamIdx;
+    LCD_StreamFlush(true);
+    lcdStreamIdx = idx;
+    Count -= LCD_DMA_BUFFER_PIXELS;
+  }
+  // El resto queda como bloque en curso; si el buffer ya está en vuelo,
+  // LCD_StreamHasSpace impedirá añadirle más píxeles.
+  lcdStreamFill = Count;
+}
+
+/**
+ * @brief Reserva espacio contiguo en el buffer de línea para escribir en sitio.
+ *
+ * Permite a un generador (texto, degradados, descompresores) escribir los
+ * colores directamente sin copia intermedia. Confirmar con LCD_StreamCommit.
+ *
+ * @param Avail Recibe el número de píxeles disponibles (>= 1).
+ * @return Puntero donde escribir como mucho *Avail colores.
+ */
+uint16_t* LCD_StreamReserve(uint32_t* Avail) {
+  LCD_StreamEnsureSpace();
+  *Avail = LCD_DMA_BUFFER_PIXELS - lcdStreamFill;
+  return lcdLineBuf[lcdStreamIdx] + lcdStreamFill;
+}
+
+/** @brief Confirma Count píxeles escritos tras LCD_StreamReserve. */
+void LCD_StreamCommit(uint32_t Count) {
+  lcdStreamFill += Count;
+}
+
+/**
+ * @brief Cierra la ventana abierta: encola el último bloque y libera CS.
+ *
+ * No espera al bus; usar LCD_WaitIdle si se necesita sincronizar.
+ */
+void LCD_EndWindow(void) {
+  if (!lcdStreamOpen) return;
+  LCD_StreamFlush(false);
+  lcdStreamOpen = false;
 }
 /******************************************************************************/
 /**
  * @brief Escribe un buffer de colores en una ventana del display.
  *
- * Calcula el número de bytes a enviar en base al ancho y alto de la ventana
- * y llama a LCD_WriteData_nbyte para transferir el buffer en formato RGB565
- * (uint16_t por píxel).
- *
- * @warning Esta implementación reserva un buffer local `Read_D` en la pila
- * cuya longitud depende de la ventana. Para ventanas grandes esto puede agotar
- * la pila. Considerar usar un buffer estático o enviar por partes si procede.
+ * Envía la ventana a través del sumidero en flujo: los colores se copian a
+ * los buffers de línea DMA ya en orden del panel, de modo que la función vuelve sin esperar a que
+ * termine el envío y `color` puede reutilizarse inmediatamente.
  *
  * @param Xstart Coordenada X inicial (pixel).
  * @param Ystart Coordenada Y inicial (pixel).
  * @param Xend   Coordenada X final (pixel).
  * @param Yend   Coordenada Y final (pixel).
- * @param color  Puntero a un buffer de uint16_t con los colores (RGB565) a escribir.
+ * @param color  Puntero a un buffer de uint16_t con los colores (RGB565 nativos) a escribir.
  */
 void LCD_addWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t* color) {
-  uint16_t Show_Width = Xend - Xstart + 1;
-  uint16_t Show_Height = Yend - Ystart + 1;
-  uint32_t numBytes = Show_Width * Show_Height * sizeof(uint16_t);
-  uint8_t Read_D[numBytes];
-  LCD_SetCursor(Xstart, Ystart, Xend, Yend);
-  LCD_WriteData_nbyte((uint8_t*)color, Read_D, numBytes);
+  LCD_BeginWindow(Xstart, Ystart, Xend, Yend);
+  LCD_PushRGB565(color, (uint32_t)(Xend - Xstart + 1) * (Yend - Ystart + 1));
+  LCD_EndWindow();
+}
+/******************************************************************************/
+/*
+ * Scroll vertical por hardware.
+ *
+ * El ST7789 desplaza líneas de barrido (el lado de 320 px del panel). Como
+ * ambas orientaciones usan MV=1, ese eje es X en HORIZONTAL e Y en VERTICAL,
+ * y el área desplazada abarca siempre todo el otro eje.
+ */
+
+/**
+ * @brief Define el área de scroll (VSCRDEF, 0x33) en líneas de barrido.
+ *
+ * @param TopFixed    Líneas fijas antes del área (TFA).
+ * @param ScrollLines Líneas del área desplazable (VSA).
+ * @param BottomFixed Líneas fijas tras el área (BFA). TFA+VSA+BFA = 320.
+ */
+void LCD_SetScrollArea(uint16_t TopFixed, uint16_t ScrollLines, uint16_t BottomFixed) {
+  const uint8_t stream[] = {
+    0x33, 6,
+    (uint8_t)(TopFixed >> 8), (uint8_t)(TopFixed & 0xFF),
+    (uint8_t)(ScrollLines >> 8), (uint8_t)(ScrollLines & 0xFF),
+    (uint8_t)(BottomFixed >> 8), (uint8_t)(BottomFixed & 0xFF),
+  };
+  LCD_WriteCommandStream(stream, sizeof(stream));
+}
+
+/**
+ * @brief Fija la línea de memoria mostrada al inicio del área (VSCSAD, 0x37).
+ *
+ * @param Line Línea de barrido, entre TFA y TFA+VSA-1.
+ */
+void LCD_SetScrollStart(uint16_t Line) {
+  const uint8_t stream[] = {0x37, 2, (uint8_t)(Line >> 8), (uint8_t)(Line & 0xFF)};
+  LCD_WriteCommandStream(stream, sizeof(stream));
 }
+
+/**
+ * @brief Convierte una coordenada lógica del eje de scroll en línea de barrido.
+ *
+ * Tiene en cuenta el offset del eje y el espejo MY de la orientación actual.
+ */
+uint16_t LCD_LogicalToScanLine(uint16_t Pos) {
+  uint16_t line = Pos + ((CurrentOrientation == HORIZONTAL) ? Offset_X : Offset_Y);
+  return lcdScanMirrored ? (LCD_SCAN_LINES - 1 - line) : line;
+}
+
+/** @brief Inversa de LCD_LogicalToScanLine. */
+uint16_t LCD_ScanLineToLogical(uint16_t Line) {
+  if (lcdScanMirrored) Line = LCD_SCAN_LINES - 1 - Line;
+  return Line - ((CurrentOrientation == HORIZONTAL) ? Offset_X : Offset_Y);
+}
+
 // backlight
 /**
  * @brief Nivel por defecto de la retroiluminación (0-100).
@@ -4,13 +4,20 @@
  */
 #pragma once
 #include <Arduino.h>
-#include <SPI.h>
+#include "PanelColor.h"
 
 
 
 /** Frecuencia SPI usada para transferencias al LCD. */
 #define SPIFreq 80000000
 
+/** Filas de pantalla que caben en cada uno de los dos buffers de línea DMA. */
+#define LCD_DMA_LINES 10
+/** Capacidad (en píxeles) de cada buffer de línea y tamaño máximo de un bloque DMA. */
+#define LCD_DMA_BUFFER_PIXELS (LCD_PHYSICAL_WIDTH * LCD_DMA_LINES)
+/** Descriptores de transacción SPI que pueden estar encolados a la vez. */
+#define LCD_TRANS_QUEUE 24
+
 // Pines SPI y control del LCD (ajustar si se usan otros pines)
 #define EXAMPLE_PIN_NUM_MISO -1
 #define EXAMPLE_PIN_NUM_MOSI 45
@@ -56,23 +63,90 @@ extern uint8_t LCD_Backlight;
 // Prototipos de funciones públicas (documentadas en Display_ST7789.cpp)
 /** Inicializa pines, SPI, retroiluminación y realiza la secuencia de arranque del display. */
 void LCD_Init(void);
+/** Arranque incremental: reset y configuración de SPI sin esperar al panel. */
+void LCD_InitStart(void);
+/** Avanza el arranque si ya venció la espera pendiente. Devuelve true al terminar. */
+bool LCD_InitPoll(void);
+/** Completa el arranque esperando sólo el tiempo que falte. */
+void LCD_InitFinish(void);
+
+/** Marca en el byte de longitud de un registro de secuencia: sigue un byte de espera en ms. */
+#define LCD_CMD_DELAY 0x80
 /** Realiza un reset físico del controlador mediante el pin RST. */
 void LCD_Reset(void);
 /** Establece la ventana (cursor) para la siguiente escritura de píxeles.
  *  x1,y1 - esquina superior/izquierda; x2,y2 - esquina inferior/derecha. */
 void LCD_SetCursor(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
-/** Escribe un buffer de colores (RGB565) en la ventana especificada. */
+/** Escribe un buffer de colores RGB565 nativos en la ventana (se pasan al orden del panel al copiarlos). */
 void LCD_addWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t* color);
 
+/** Callback de fin de transferencia. Se invoca desde la ISR del SPI: debe ser breve y estar en IRAM. */
+typedef void (*LCD_TransferDoneCallback)(void* arg);
+/** Devuelve el siguiente buffer de línea DMA libre (doble buffer, LCD_DMA_BUFFER_PIXELS colores en orden del panel). */
+uint16_t* LCD_AcquireLineBuffer(void);
+/** Encola ventana + píxeles por DMA sin bloquear. Done (opcional) se llama al terminar. */
+void LCD_QueueWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend,
+                     uint16_t* Buffer, LCD_TransferDoneCallback Done, void* Arg);
+/** Espera a que terminen todas las transferencias encoladas. */
+void LCD_WaitIdle(void);
+
+// Escritura en flujo: abrir ventana, enviar tramos de píxeles y cerrar.
+/** Abre una ventana; los píxeles siguientes la rellenan fila a fila. */
+void LCD_BeginWindow(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend);
+/** Añade Count colores ya en orden del panel (se copian; el buffer puede reutilizarse al volver). */
+void LCD_PushPixels(const uint16_t* Pixels, uint32_t Count);
+/** Como LCD_PushPixels, pero con colores RGB565 nativos: intercambia los bytes al copiar. */
+void LCD_PushRGB565(const uint16_t* Pixels, uint32_t Count);
+/** Añade Count repeticiones de un mismo color. */
+void LCD_PushColor(PanelColor Color, uint32_t Count);
+/** Reserva hueco en el buffer de línea para escribir en sitio; *Avail recibe su tamaño. */
+uint16_t* LCD_StreamReserve(uint32_t* Avail);
+/** Confirma los píxeles escritos tras LCD_StreamReserve. */
+void LCD_StreamCommit(uint32_t Count);
+/** Cierra la ventana abierta y libera CS (no espera al bus). */
+void LCD_EndWindow(void);
+
 /** Enviar comando (8-bit) al controlador. */
 void LCD_WriteCommand(uint8_t Cmd);
 /** Enviar dato (8-bit) al controlador. */
 void LCD_WriteData(uint8_t Data);
 /** Enviar dato de 16-bit (usado para colores RGB565). */
 void LCD_WriteData_Word(uint16_t Data);
-/** Transferencia de múltiples bytes (envío/lectura simultánea). */
+/** Transferencia de múltiples bytes (sólo escritura; ReadData se ignora). */
 void LCD_WriteData_nbyte(uint8_t* SetData, uint8_t* ReadData, uint32_t Size);
 
+/** Longitud en bytes del flujo CASET/RASET/RAMWR generado por LCD_EncodeWindow. */
+#define LCD_WINDOW_STREAM_LEN 14
+
+/** Envía un flujo de registros {comando, N, datos[N]} bajo una sola aserción de CS. */
+void LCD_WriteCommandStream(const uint8_t* Stream, uint32_t Len);
+/** Codifica la ventana x1,y1..x2,y2 como flujo CASET/RASET/RAMWR. Devuelve la longitud. */
+uint32_t LCD_EncodeWindow(uint8_t* Out, uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend);
+
+/** Contadores de tráfico SPI, útiles para medir el coste de cada primitiva. */
+typedef struct {
+  uint32_t transactions;  // Aserciones de CS
+  uint32_t bytes;         // Bytes enviados (comandos + datos)
+  uint32_t windows;       // Ventanas CASET/RASET/RAMWR establecidas
+} LCD_Stats;
+
+/** Devuelve los contadores acumulados desde el último LCD_ResetStats(). */
+LCD_Stats LCD_GetStats(void);
+/** Pone a cero los contadores de tráfico. */
+void LCD_ResetStats(void);
+
+/** Líneas de barrido del panel (lado largo); es el eje del scroll por hardware. */
+#define LCD_SCAN_LINES 320
+
+/** Define el área de scroll por hardware (TFA + VSA + BFA = LCD_SCAN_LINES). */
+void LCD_SetScrollArea(uint16_t TopFixed, uint16_t ScrollLines, uint16_t BottomFixed);
+/** Línea de memoria que se muestra al comienzo del área de scroll. */
+void LCD_SetScrollStart(uint16_t Line);
+/** Coordenada lógica del eje de scroll (X en horizontal, Y en vertical) -> línea de barrido. */
+uint16_t LCD_LogicalToScanLine(uint16_t Pos);
+/** Línea de barrido -> coordenada lógica del eje de scroll. */
+uint16_t LCD_ScanLineToLogical(uint16_t Line);
+
 /** Inicializa la retroiluminación (PWM) y aplica el nivel por defecto. */
 void Backlight_Init(void);
 /** Ajusta la intensidad de la retroiluminación (0..100). */
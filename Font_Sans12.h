@@ -0,0 +1,190 @@
+// Font_Sans12.h
+// Generado por tools/ttf2font.py desde DejaVuSans.ttf (12 px, 2 bpp). No editar a mano.
+#pragma once
+#include "AAFont.h"
+
+static constexpr uint8_t FontSans12Bitmap[] = {
+  0x67, 0x77, 0x73, 0x12, 0x70, 0x99, 0x99, 0x99, 0x44, 0x01, 0x04, 0x00, 0xC6, 0x01, 0x66, 0x91,
+  0xBE, 0xE9, 0x09, 0x30, 0x17, 0x59, 0x0A, 0xEA, 0x90, 0x62, 0x00, 0x24, 0xC0, 0x00, 0x08, 0x02,
+  0xE8, 0xA8, 0x4C, 0x80, 0xB9, 0x01, 0xAD, 0x08, 0xA4, 0x89, 0xBF, 0x80, 0x80, 0x04, 0x00, 0x2A,
+  0x01, 0x81, 0x86, 0x08, 0x06, 0x18, 0xA0, 0x18, 0x62, 0x00, 0x1A, 0x25, 0x90, 0x01, 0x8D, 0x90,
+  0x08, 0x61, 0x80, 0x91, 0x86, 0x02, 0x02, 0xA4, 0x00, 0x01, 0x00, 0x06, 0xE0, 0x03, 0x44, 0x01,
+  0xC0, 0x00, 0x38, 0x00, 0x2A, 0x81, 0x4C, 0x28, 0x97, 0x02, 0xB0, 0xD0, 0x78, 0x1E, 0xB6, 0x80,
+  0x40, 0x00, 0x99, 0x94, 0x24, 0xC6, 0x24, 0xD3, 0x4D, 0x24, 0x60, 0xC1, 0x40, 0x91, 0x83, 0x49,
+  0x28, 0xA2, 0x89, 0x32, 0x84, 0x00, 0x05, 0x05, 0x55, 0x1A, 0x42, 0xA8, 0x45, 0x10, 0x01, 0x40,
+  0x02, 0x80, 0x02, 0x80, 0x56, 0x95, 0xAB, 0xEA, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x5A, 0xC4,
+  0x6A, 0x15, 0x5A, 0x02, 0x06, 0x09, 0x0C, 0x18, 0x24, 0x30, 0x60, 0xA0, 0x90, 0x0B, 0x90, 0xA1,
+  0xD3, 0x42, 0x9C, 0x06, 0x70, 0x19, 0xC0, 0x63, 0x42, 0x8A, 0x0D, 0x0A, 0xE0, 0x04, 0x00, 0x69,
+  0x0A, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0xBF, 0xE0, 0xAE, 0x49, 0x1C,
+  0x00, 0x90, 0x0D, 0x02, 0x80, 0xA0, 0x28, 0x0A, 0x00, 0xFF, 0xE0, 0xAE, 0x45, 0x1D, 0x00, 0xA0,
+  0x5C, 0x1B, 0x80, 0x09, 0x00, 0xA0, 0x09, 0xFB, 0x80, 0x40, 0x00, 0xA0, 0x0B, 0x80, 0x6A, 0x03,
+  0x28, 0x28, 0xA1, 0x82, 0x8B, 0xFF, 0xC0, 0x28, 0x00, 0xA0, 0xAA, 0x8A, 0x54, 0xA0, 0x0B, 0xA4,
+  0x56, 0xC0, 0x0A, 0x00, 0xA0, 0x1D, 0xFB, 0x80, 0x40, 0x06, 0xE0, 0x74, 0x42, 0x40, 0x0D, 0xA4,
+  0x79, 0x78, 0xD0, 0x63, 0x41, 0x8A, 0x0A, 0x0A, 0xE0, 0xAA, 0x95, 0x5D, 0x01, 0xC0, 0x28, 0x03,
+  0x00, 0x60, 0x0D, 0x01, 0xC0, 0x28, 0x00, 0x1B, 0xA0, 0xA0, 0xD3, 0x42, 0x8A, 0x1D, 0x0F, 0xE0,
+  0xD0, 0xA7, 0x01, 0x8D, 0x0A, 0x1E, 0xE0, 0x04, 0x00, 0x0B, 0x90, 0xE1, 0xC7, 0x02, 0x9C, 0x0A,
+  0x34, 0x38, 0x7F, 0xA0, 0x02, 0x80, 0x1C, 0x2E, 0xD0, 0x04, 0x00, 0x1A, 0x10, 0x05, 0xA0, 0x1A,
+  0x10, 0x05, 0xAC, 0x40, 0x00, 0x0A, 0x01, 0xB9, 0x6E, 0x40, 0xB4, 0x00, 0x0B, 0x90, 0x00, 0x6E,
+  0x00, 0x01, 0x6A, 0xA9, 0x6A, 0xA9, 0x00, 0x00, 0xBF, 0xFE, 0xA0, 0x00, 0x6E, 0x40, 0x01, 0xB9,
+  0x00, 0x1E, 0x06, 0xE4, 0xB9, 0x00, 0x40, 0x00, 0x2B, 0x86, 0x0D, 0x00, 0xA0, 0x18, 0x07, 0x00,
+  0xA0, 0x09, 0x00, 0x50, 0x0A, 0x00, 0x00, 0x59, 0x00, 0x06, 0xAA, 0x90, 0x0D, 0x00, 0x24, 0x24,
+  0x69, 0x4C, 0x21, 0xC3, 0x88, 0x62, 0x82, 0x89, 0x61, 0x82, 0x8C, 0x30, 0xD7, 0xA4, 0x28, 0x24,
+  0x40, 0x0A, 0x00, 0x90, 0x02, 0xEB, 0x80, 0x02, 0x80, 0x03, 0xD0, 0x06, 0xA0, 0x09, 0x30, 0x1C,
+  0x24, 0x29, 0x68, 0x3A, 0xAC, 0x70, 0x0A, 0xA0, 0x07, 0xAA, 0x82, 0x56, 0x89, 0x07, 0x25, 0x68,
+  0xAA, 0xD2, 0x41, 0xC9, 0x03, 0x64, 0x1D, 0xBF, 0xD0, 0x06, 0xF9, 0x1D, 0x06, 0x34, 0x00, 0x70,
+  0x00, 0x70, 0x00, 0x70, 0x00, 0x34, 0x00, 0x28, 0x01, 0x0B, 0xAD, 0x00, 0x50, 0xAA, 0x90, 0x95,
+  0xB8, 0x90, 0x1C, 0x90, 0x09, 0x90, 0x0A, 0x90, 0x0A, 0x90, 0x0D, 0x90, 0x68, 0xBF, 0xA0, 0xAA,
+  0xA9, 0x55, 0x90, 0x09, 0x54, 0xAA, 0x99, 0x00, 0x90, 0x09, 0x00, 0xBF, 0xE0, 0xAA, 0x99, 0x54,
+  0x90, 0x09, 0x54, 0xAA, 0x89, 0x00, 0x90, 0x09, 0x00, 0x90, 0x00, 0x06, 0xF9, 0x07, 0x41, 0x83,
+  0x40, 0x01, 0xC0, 0x00, 0x70, 0x1A, 0x1C, 0x06, 0xD3, 0x40, 0x24, 0xA0, 0x09, 0x0B, 0xAE, 0x00,
+  0x14, 0x00, 0x90, 0x1A, 0x40, 0x69, 0x01, 0xA5, 0x56, 0xAA, 0xAA, 0x40, 0x69, 0x01, 0xA4, 0x06,
+  0x90, 0x18, 0x99, 0x99, 0x99, 0x99, 0x90, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x0D, 0x68, 0x50, 0x90, 0x26, 0x47, 0x49, 0x74, 0x27, 0x40, 0xB8, 0x02, 0x68, 0x09, 0x28, 0x24,
+  0x28, 0x90, 0x28, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0xBF,
+  0xE0, 0xA0, 0x0A, 0x6D, 0x03, 0xD9, 0x81, 0xB6, 0x70, 0x9D, 0x96, 0x73, 0x64, 0xE4, 0xD9, 0x2C,
+  0x36, 0x41, 0x0D, 0x90, 0x03, 0x40, 0xA0, 0x1A, 0xD0, 0x6A, 0xC1, 0xA6, 0x86, 0x97, 0x1A, 0x4A,
+  0x69, 0x0D, 0xA4, 0x2E, 0x90, 0x38, 0x06, 0xE8, 0x07, 0x42, 0x83, 0x40, 0x35, 0xC0, 0x0A, 0x70,
+  0x02, 0x9C, 0x00, 0xA3, 0x40, 0x24, 0xA0, 0x2C, 0x0B, 0xB9, 0x00, 0x10, 0x00, 0xAA, 0x49, 0x5E,
+  0x90, 0xA9, 0x0A, 0xAA, 0xDA, 0xA0, 0x90, 0x09, 0x00, 0x90, 0x00, 0x06, 0xE8, 0x07, 0x42, 0x83,
+  0x40, 0x35, 0xC0, 0x0A, 0x70, 0x02, 0x9C, 0x00, 0xA3, 0x40, 0x24, 0xA0, 0x2C, 0x0B, 0xB9, 0x00,
+  0x17, 0x00, 0x00, 0x50, 0xAA, 0x42, 0x57, 0x89, 0x0A, 0x24, 0x28, 0xAA, 0xD2, 0x5B, 0x49, 0x0A,
+  0x24, 0x0D, 0x90, 0x28, 0x1B, 0xE4, 0xD0, 0x57, 0x00, 0x0E, 0x40, 0x1B, 0xE0, 0x01, 0xA0, 0x01,
+  0xC4, 0x0A, 0x6E, 0xF4, 0x04, 0x00, 0xAA, 0xA9, 0x57, 0x54, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40,
+  0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x90, 0x1B, 0x40, 0xAD, 0x02, 0xB4, 0x0A, 0xD0,
+  0x2B, 0x40, 0xAD, 0x02, 0xA8, 0x0D, 0x2E, 0xE0, 0x04, 0x00, 0x90, 0x06, 0x60, 0x0A, 0x34, 0x0D,
+  0x28, 0x1C, 0x1C, 0x28, 0x0D, 0x30, 0x0A, 0x60, 0x03, 0xD0, 0x02, 0xC0, 0x60, 0x28, 0x09, 0x70,
+  0x3C, 0x0D, 0x30, 0x69, 0x1C, 0x24, 0x99, 0x28, 0x28, 0x96, 0x24, 0x1C, 0xC3, 0x30, 0x0D, 0x82,
+  0x70, 0x0B, 0x42, 0xE0, 0x0B, 0x41, 0xD0, 0x24, 0x09, 0x18, 0x18, 0x0A, 0x74, 0x03, 0xA0, 0x02,
+  0xC0, 0x07, 0xA0, 0x0D, 0x34, 0x28, 0x18, 0x70, 0x0A, 0x90, 0x09, 0xC0, 0xA2, 0x86, 0x02, 0xB4,
+  0x07, 0x80, 0x0D, 0x00, 0x34, 0x00, 0xD0, 0x03, 0x40, 0x6A, 0xA9, 0x15, 0x5D, 0x00, 0x34, 0x00,
+  0xA0, 0x02, 0x80, 0x07, 0x00, 0x1D, 0x00, 0x34, 0x00, 0xBF, 0xFE, 0xE7, 0x0C, 0x30, 0xC3, 0x0C,
+  0x30, 0xC3, 0x4A, 0x40, 0x80, 0x90, 0x60, 0x30, 0x24, 0x18, 0x0C, 0x09, 0x06, 0x03, 0xB8, 0xA2,
+  0x8A, 0x28, 0xA2, 0x8A, 0x29, 0xA6, 0x40, 0x02, 0x80, 0x0A, 0xA0, 0x28, 0x28, 0x50, 0x05, 0xAA,
+  0xA0, 0x50, 0xC1, 0x40, 0x1A, 0x80, 0x56, 0xC0, 0x17, 0x4B, 0xAD, 0x70, 0x35, 0xC1, 0xD2, 0xEA,
+  0x40, 0xD0, 0x0D, 0x00, 0xDA, 0x4E, 0x5D, 0xD0, 0x6D, 0x07, 0xD0, 0x7E, 0x0A, 0xEA, 0x80, 0x10,
+  0x06, 0x92, 0x95, 0x70, 0x06, 0x00, 0x70, 0x03, 0x40, 0x1E, 0xA0, 0x10, 0x00, 0x28, 0x00, 0xA0,
+  0xA6, 0x8A, 0x5E, 0x70, 0x29, 0x80, 0xA6, 0x02, 0x8D, 0x0E, 0x1E, 0xA8, 0x04, 0x00, 0x06, 0x90,
+  0xA5, 0xD7, 0x01, 0x9E, 0xAA, 0x70, 0x00, 0xD0, 0x01, 0xEB, 0x40, 0x10, 0x1E, 0x4A, 0x07, 0xA1,
+  0xA4, 0x28, 0x0A, 0x02, 0x80, 0xA0, 0x28, 0x00, 0x0A, 0x54, 0xA5, 0xE7, 0x02, 0x98, 0x0A, 0x70,
+  0x28, 0xD1, 0xE1, 0xFA, 0x80, 0x09, 0x1A, 0xA0, 0x19, 0x00, 0xD0, 0x0D, 0x00, 0xDA, 0x4E, 0x5D,
+  0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xA0, 0x94, 0x49, 0x99, 0x99, 0x90, 0x24, 0x41, 0x09,
+  0x24, 0x92, 0x49, 0x24, 0xDB, 0x20, 0xD0, 0x0D, 0x00, 0xD0, 0x5D, 0x28, 0xD9, 0x0F, 0x80, 0xDD,
+  0x0D, 0x74, 0xD1, 0xD0, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9A, 0x4A, 0x8E, 0x5E, 0x5D, 0xD0, 0xA0,
+  0xAD, 0x0A, 0x0A, 0xD0, 0xA0, 0xAD, 0x0A, 0x0A, 0xD0, 0xA0, 0xA0, 0x9A, 0x4E, 0x5D, 0xD0, 0xAD,
+  0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xA0, 0x0A, 0x90, 0xA5, 0xC7, 0x02, 0x98, 0x0A, 0x70, 0x28, 0xD0,
+  0xD1, 0xEE, 0x00, 0x40, 0x9A, 0x4E, 0x5D, 0xD0, 0x6D, 0x07, 0xD0, 0x7E, 0x0A, 0xEA, 0x8D, 0x10,
+  0xD0, 0x08, 0x00, 0x0A, 0x54, 0xA5, 0xE7, 0x02, 0x98, 0x0A, 0x60, 0x28, 0xD0, 0xE1, 0xEA, 0x80,
+  0x4A, 0x00, 0x28, 0x00, 0x50, 0x9A, 0xF5, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0x1A, 0x87, 0x54, 0x70,
+  0x02, 0xE4, 0x01, 0xA0, 0x0A, 0x7A, 0xD0, 0x50, 0x20, 0x0D, 0x07, 0xA5, 0xD4, 0x34, 0x0D, 0x03,
+  0x40, 0x90, 0x1F, 0x80, 0x80, 0x5C, 0x0A, 0xC0, 0xAC, 0x0A, 0xC0, 0xAD, 0x0E, 0x7A, 0xA0, 0x40,
+  0x50, 0x15, 0xC0, 0x93, 0x43, 0x0A, 0x28, 0x0C, 0xD0, 0x2B, 0x00, 0x74, 0x00, 0x50, 0x50, 0x5C,
+  0x38, 0x33, 0x1B, 0x18, 0x99, 0x9A, 0x1A, 0x1A, 0x47, 0xC3, 0xC0, 0xE0, 0xA0, 0x20, 0x14, 0xA2,
+  0x80, 0xAC, 0x01, 0xD0, 0x0A, 0x80, 0xA2, 0x87, 0x03, 0x40, 0x50, 0x15, 0xC0, 0x92, 0x47, 0x06,
+  0x28, 0x0D, 0xC0, 0x2A, 0x00, 0x34, 0x01, 0xC0, 0x2A, 0x00, 0x90, 0x00, 0x2A, 0x91, 0x5A, 0x01,
+  0x80, 0x70, 0x1D, 0x03, 0x40, 0xBA, 0xA0, 0x07, 0x90, 0xA0, 0x0A, 0x00, 0xA0, 0x0D, 0x07, 0x80,
+  0x09, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x06, 0xD0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x6C, 0x00,
+  0x90, 0x09, 0x00, 0x90, 0x0A, 0x00, 0x79, 0x0A, 0x00, 0x90, 0x09, 0x00, 0xD0, 0xB8, 0x00, 0x19,
+  0x01, 0xA6, 0xED,
+};
+
+static constexpr AAGlyph FontSans12Glyphs[] = {
+  {    0,  0,  0,   0,   0,  4 },  // ' '
+  {    0,  2,  9,   1,  -9,  5 },  // '!'
+  {    5,  4,  4,   1,  -9,  6 },  // '"'
+  {    9,  9,  9,   1,  -9, 10 },  // '#'
+  {   30,  6, 11,   1,  -9,  8 },  // '$'
+  {   47, 11, 10,   0,  -9, 11 },  // '%'
+  {   75,  9, 10,   0,  -9,  9 },  // '&'
+  {   98,  2,  4,   1,  -9,  3 },  // '\''
+  {  100,  3, 11,   1,  -9,  5 },  // '('
+  {  109,  3, 11,   1,  -9,  5 },  // ')'
+  {  118,  6,  5,   0,  -9,  6 },  // '*'
+  {  126,  8,  8,   1,  -8, 10 },  // '+'
+  {  142,  2,  4,   1,  -2,  4 },  // ','
+  {  144,  4,  2,   0,  -4,  4 },  // '-'
+  {  146,  2,  2,   1,  -2,  4 },  // '.'
+  {  147,  4, 10,   0,  -9,  4 },  // '/'
+  {  157,  7, 10,   0,  -9,  8 },  // '0'
+  {  175,  6,  9,   1,  -9,  8 },  // '1'
+  {  189,  6,  9,   1,  -9,  8 },  // '2'
+  {  203,  6, 10,   1,  -9,  8 },  // '3'
+  {  218,  7,  9,   0,  -9,  8 },  // '4'
+  {  234,  6, 10,   1,  -9,  8 },  // '5'
+  {  249,  7,  9,   0,  -9,  8 },  // '6'
+  {  265,  6,  9,   1,  -9,  8 },  // '7'
+  {  279,  7, 10,   0,  -9,  8 },  // '8'
+  {  297,  7, 10,   0,  -9,  8 },  // '9'
+  {  315,  2,  7,   1,  -7,  4 },  // ':'
+  {  319,  2,  9,   1,  -7,  4 },  // ';'
+  {  324,  8,  7,   1,  -7, 10 },  // '<'
+  {  338,  8,  4,   1,  -6, 10 },  // '='
+  {  346,  8,  7,   1,  -7, 10 },  // '>'
+  {  360,  6,  9,   0,  -9,  6 },  // '?'
+  {  374, 12, 11,   0,  -9, 12 },  // '@'
+  {  407,  8,  9,   0,  -9,  8 },  // 'A'
+  {  425,  7,  9,   1,  -9,  8 },  // 'B'
+  {  441,  8, 10,   0,  -9,  8 },  // 'C'
+  {  461,  8,  9,   1,  -9,  9 },  // 'D'
+  {  479,  6,  9,   1,  -9,  8 },  // 'E'
+  {  493,  6,  9,   1,  -9,  7 },  // 'F'
+  {  507,  9, 10,   0,  -9,  9 },  // 'G'
+  {  530,  7,  9,   1,  -9,  9 },  // 'H'
+  {  546,  2,  9,   1,  -9,  4 },  // 'I'
+  {  551,  4, 12,  -1,  -9,  4 },  // 'J'
+  {  563,  7,  9,   1,  -9,  8 },  // 'K'
+  {  579,  6,  9,   1,  -9,  7 },  // 'L'
+  {  593,  9,  9,   1,  -9, 10 },  // 'M'
+  {  614,  7,  9,   1,  -9,  9 },  // 'N'
+  {  630,  9, 10,   0,  -9,  9 },  // 'O'
+  {  653,  6,  9,   1,  -9,  7 },  // 'P'
+  {  667,  9, 11,   0,  -9,  9 },  // 'Q'
+  {  692,  7,  9,   1,  -9,  8 },  // 'R'
+  {  708,  7, 10,   0,  -9,  8 },  // 'S'
+  {  726,  8,  9,   0,  -9,  7 },  // 'T'
+  {  744,  7, 10,   1,  -9,  9 },  // 'U'
+  {  762,  8,  9,   0,  -9,  8 },  // 'V'
+  {  780, 12,  9,   0,  -9, 12 },  // 'W'
+  {  807,  8,  9,   0,  -9,  8 },  // 'X'
+  {  825,  7,  9,   0,  -9,  7 },  // 'Y'
+  {  841,  8,  9,   0,  -9,  8 },  // 'Z'
+  {  859,  3, 11,   1,  -9,  5 },  // '['
+  {  868,  4, 10,   0,  -9,  4 },  // '\\'
+  {  878,  3, 11,   1,  -9,  5 },  // ']'
+  {  887,  8,  4,   1,  -9, 10 },  // '^'
+  {  895,  6,  1,   0,   2,  6 },  // '_'
+  {  897,  3,  3,   1, -10,  6 },  // '`'
+  {  900,  7,  7,   0,  -7,  7 },  // 'a'
+  {  913,  6, 10,   1,  -9,  8 },  // 'b'
+  {  928,  6,  8,   0,  -7,  7 },  // 'c'
+  {  940,  7, 10,   0,  -9,  8 },  // 'd'
+  {  958,  7,  8,   0,  -7,  7 },  // 'e'
+  {  972,  5,  9,   0,  -9,  4 },  // 'f'
+  {  984,  7, 10,   0,  -7,  8 },  // 'g'
+  { 1002,  6,  9,   1,  -9,  8 },  // 'h'
+  { 1016,  2,  9,   1,  -9,  3 },  // 'i'
+  { 1021,  3, 12,   0,  -9,  3 },  // 'j'
+  { 1030,  6,  9,   1,  -9,  7 },  // 'k'
+  { 1044,  2,  9,   1,  -9,  3 },  // 'l'
+  { 1049, 10,  7,   1,  -7, 12 },  // 'm'
+  { 1067,  6,  7,   1,  -7,  8 },  // 'n'
+  { 1078,  7,  8,   0,  -7,  7 },  // 'o'
+  { 1092,  6, 10,   1,  -7,  8 },  // 'p'
+  { 1107,  7, 10,   0,  -7,  8 },  // 'q'
+  { 1125,  4,  7,   1,  -7,  5 },  // 'r'
+  { 1132,  6,  8,   0,  -7,  6 },  // 's'
+  { 1144,  5,  9,   0,  -9,  5 },  // 't'
+  { 1156,  6,  8,   1,  -7,  8 },  // 'u'
+  { 1168,  7,  7,   0,  -7,  7 },  // 'v'
+  { 1181,  9,  7,   0,  -7, 10 },  // 'w'
+  { 1197,  7,  7,   0,  -7,  7 },  // 'x'
+  { 1210,  7, 10,   0,  -7,  7 },  // 'y'
+  { 1228,  6,  7,   0,  -7,  6 },  // 'z'
+  { 1239,  6, 11,   1,  -9,  8 },  // '{'
+  { 1256,  2, 12,   1,  -9,  4 },  // '|'
+  { 1262,  6, 11,   1,  -9,  8 },  // '}'
+  { 1279,  8,  2,   1,  -5, 10 },  // '~'
+};
+
+static constexpr AAFont FontSans12 = {
+  FontSans12Bitmap, FontSans12Glyphs, 0x20, 0x7E, 14, 11, 2
+};
@@ -0,0 +1,352 @@
+// Font_SansBold20.h
+// Generado por tools/ttf2font.py desde DejaVuSans-Bold.ttf (20 px, 2 bpp). No editar a mano.
+#pragma once
+#include "AAFont.h"
+
+static constexpr uint8_t FontSansBold20Bitmap[] = {
+  0x2A, 0x1F, 0xD7, 0xF5, 0xFD, 0x7F, 0x5F, 0xD3, 0xF4, 0xFC, 0x3F, 0x0B, 0xC0, 0x00, 0xA8, 0x7F,
+  0x5F, 0xD7, 0xF4, 0xA0, 0x67, 0xD2, 0xEF, 0x4B, 0xBD, 0x2E, 0xF4, 0xBA, 0x92, 0x90, 0x00, 0x05,
+  0x01, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x02, 0xD0, 0xF4, 0x00, 0x0F, 0x47, 0xC0, 0x1A, 0xBE, 0xAF,
+  0xA4, 0xBF, 0xFF, 0xFF, 0xE1, 0xAF, 0xAB, 0xEA, 0x40, 0x3D, 0x1F, 0x00, 0x01, 0xF0, 0xB8, 0x02,
+  0xAF, 0xEB, 0xFA, 0x4B, 0xFF, 0xFF, 0xFD, 0x15, 0xF5, 0x7D, 0x50, 0x07, 0xC2, 0xE0, 0x00, 0x2E,
+  0x0B, 0x40, 0x00, 0xB4, 0x3D, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
+  0x06, 0xFF, 0xA4, 0x2F, 0xFF, 0xF8, 0x7F, 0x69, 0xA8, 0xBE, 0x28, 0x00, 0x7F, 0x68, 0x00, 0x3F,
+  0xFE, 0x90, 0x1F, 0xFF, 0xF8, 0x01, 0xBF, 0xFD, 0x00, 0x28, 0xFE, 0x40, 0x28, 0xBE, 0xB9, 0x69,
+  0xFD, 0xBF, 0xFF, 0xF8, 0x1A, 0xFF, 0x90, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
+  0x06, 0xA4, 0x00, 0x29, 0x00, 0x2F, 0xBE, 0x00, 0x7C, 0x00, 0x3D, 0x1F, 0x40, 0xF4, 0x00, 0x7C,
+  0x0F, 0x42, 0xE0, 0x00, 0x7C, 0x0F, 0x83, 0xC0, 0x00, 0x7D, 0x1F, 0x4B, 0x40, 0x00, 0x2F, 0xBE,
+  0x1E, 0x00, 0x00, 0x0B, 0xF8, 0x3D, 0x1A, 0x90, 0x00, 0x00, 0xB8, 0x7F, 0xF4, 0x00, 0x00, 0xF0,
+  0xF8, 0xBC, 0x00, 0x02, 0xD1, 0xF0, 0x3D, 0x00, 0x07, 0x82, 0xF0, 0x3D, 0x00, 0x0F, 0x41, 0xF4,
+  0x7D, 0x00, 0x2E, 0x00, 0xFA, 0xBC, 0x00, 0x3C, 0x00, 0x6F, 0xE4, 0x00, 0x14, 0x00, 0x05, 0x40,
+  0x00, 0x6A, 0xA4, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x07, 0xFA, 0xB8, 0x00, 0x0B, 0xF0, 0x04, 0x00,
+  0x07, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xA8, 0x2F, 0xFF, 0x81, 0xF8,
+  0x7F, 0x5F, 0xE2, 0xF8, 0xBE, 0x0B, 0xFB, 0xF4, 0xBE, 0x02, 0xFF, 0xE0, 0xBF, 0x00, 0xBF, 0xC0,
+  0x7F, 0xD5, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xE3, 0xFD, 0x00, 0x54, 0x00, 0x00,
+  0xA3, 0xDF, 0x7D, 0xF6, 0x90, 0x00, 0x50, 0x0B, 0xD0, 0x7E, 0x02, 0xF4, 0x1F, 0xC0, 0xBE, 0x03,
+  0xF4, 0x0F, 0xD0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xD0, 0x3F, 0x40, 0xBE, 0x01, 0xF8, 0x03,
+  0xF0, 0x0B, 0xE0, 0x0F, 0xC0, 0x1A, 0x40, 0x14, 0x00, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x0B, 0xD0,
+  0x2F, 0x80, 0x7F, 0x00, 0xFD, 0x03, 0xF4, 0x0F, 0xE0, 0x3F, 0x40, 0xFD, 0x07, 0xF0, 0x1F, 0xC0,
+  0xBE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x06, 0xA0, 0x00, 0x00, 0x60, 0x00, 0x0B, 0x00, 0x78, 0xB1,
+  0xA2, 0xFB, 0xBD, 0x06, 0xFE, 0x00, 0xBF, 0xF4, 0x7E, 0xB7, 0xE2, 0x0B, 0x05, 0x00, 0xB0, 0x00,
+  0x06, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00,
+  0x2E, 0x00, 0x2A, 0xAF, 0xAA, 0x9F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0x00, 0x2E, 0x00, 0x00,
+  0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2A, 0x4F, 0xE3,
+  0xF8, 0xFD, 0x7E, 0x2F, 0x0A, 0x40, 0x55, 0x53, 0xFF, 0xDF, 0xFF, 0x6A, 0xA9, 0xA9, 0xFE, 0xFE,
+  0xFE, 0x00, 0x28, 0x01, 0xF0, 0x0B, 0x80, 0x2D, 0x00, 0xF0, 0x07, 0x80, 0x2D, 0x00, 0xF0, 0x07,
+  0x80, 0x2D, 0x00, 0xF0, 0x07, 0x80, 0x2E, 0x00, 0xF4, 0x07, 0xC0, 0x2E, 0x00, 0xA4, 0x00, 0x01,
+  0xAA, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0xEB, 0xF8, 0x7F, 0x42, 0xFD, 0xBF, 0x00, 0xFE, 0xFE, 0x00,
+  0xFE, 0xFE, 0x00, 0xBF, 0xFE, 0x00, 0xBF, 0xFE, 0x00, 0xBF, 0xFE, 0x00, 0xFE, 0xBF, 0x00, 0xFE,
+  0x7F, 0x41, 0xFD, 0x3F, 0x97, 0xFC, 0x1F, 0xFF, 0xF4, 0x06, 0xFF, 0x90, 0x00, 0x14, 0x00, 0x06,
+  0xA8, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x15, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00,
+  0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40,
+  0x6A, 0xFE, 0xA6, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x80, 0x1A, 0xAA, 0x40, 0xBF, 0xFF, 0xE0, 0xBF,
+  0xAF, 0xF8, 0xA4, 0x07, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x1F,
+  0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xEA, 0xA9,
+  0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x1A, 0xAA, 0x40, 0x3F, 0xFF, 0xF4, 0x3E, 0xAF, 0xF8, 0x10,
+  0x07, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF8, 0x06, 0xAF, 0xE0, 0x07, 0xFF, 0x90, 0x06, 0xAF,
+  0xF8, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFD, 0xB9, 0x5B, 0xFC, 0xBF, 0xFF, 0xF4,
+  0xBF, 0xFF, 0x90, 0x01, 0x54, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xF0, 0x01,
+  0xFF, 0xF0, 0x03, 0xEB, 0xF0, 0x0B, 0xCB, 0xF0, 0x1F, 0x4B, 0xF0, 0x3E, 0x0B, 0xF0, 0xBC, 0x0B,
+  0xF0, 0xFA, 0xAF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x5B, 0xF5, 0x00, 0x0B, 0xF0,
+  0x00, 0x0B, 0xF0, 0x2A, 0xAA, 0xA4, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x3F, 0x55, 0x50, 0x3F,
+  0x00, 0x00, 0x3F, 0xAA, 0x40, 0x3F, 0xFF, 0xE4, 0x3F, 0xAF, 0xF8, 0x10, 0x03, 0xFD, 0x00, 0x01,
+  0xFE, 0x00, 0x01, 0xFE, 0x40, 0x02, 0xFD, 0xB9, 0x5B, 0xFC, 0xBF, 0xFF, 0xF4, 0x6F, 0xFF, 0x90,
+  0x00, 0x54, 0x00, 0x00, 0x6A, 0xA4, 0x07, 0xFF, 0xFC, 0x1F, 0xFA, 0xBC, 0x2F, 0xD0, 0x04, 0x7F,
+  0x40, 0x00, 0xBF, 0x1A, 0x40, 0xBF, 0xFF, 0xF4, 0xBF, 0xFB, 0xFC, 0xBF, 0x81, 0xFE, 0xBF, 0x40,
+  0xFE, 0xBF, 0x40, 0xBE, 0x7F, 0x40, 0xFE, 0x2F, 0xD2, 0xFD, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xE0,
+  0x00, 0x15, 0x00, 0x6A, 0xAA, 0xA8, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x55, 0x57, 0xFC, 0x00,
+  0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0xBF,
+  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00,
+  0x06, 0xAA, 0x80, 0x2F, 0xFF, 0xF4, 0x7F, 0xEB, 0xFC, 0xBF, 0x41, 0xFD, 0x7F, 0x01, 0xFD, 0x3F,
+  0x82, 0xFC, 0x1F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x2F, 0xEB, 0xF8, 0xBF, 0x00, 0xFD, 0xBE, 0x00,
+  0xFE, 0xBF, 0x00, 0xFE, 0xBF, 0x82, 0xFD, 0x3F, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0, 0x00, 0x55, 0x00,
+  0x02, 0xAA, 0x00, 0x1F, 0xFF, 0xD0, 0x7F, 0xEB, 0xF4, 0xBF, 0x02, 0xFC, 0xFE, 0x02, 0xFD, 0xFE,
+  0x02, 0xFE, 0xFF, 0x02, 0xFE, 0xBF, 0x9B, 0xFE, 0x2F, 0xFF, 0xFE, 0x0B, 0xFE, 0xFE, 0x00, 0x01,
+  0xFD, 0x00, 0x02, 0xFC, 0x25, 0x5B, 0xF4, 0x3F, 0xFF, 0xE0, 0x2F, 0xFE, 0x40, 0x01, 0x50, 0x00,
+  0xBE, 0xBE, 0xBE, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0xBE, 0xBE, 0xBE, 0x2F, 0x8B, 0xE2, 0xF8, 0xAA,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x2F, 0x8B, 0xE3, 0xF8, 0xFC, 0x7D, 0x1A, 0x00, 0x00, 0x00, 0x06,
+  0x80, 0x00, 0x1B, 0xE0, 0x01, 0xBF, 0xF4, 0x1B, 0xFF, 0x90, 0xBF, 0xF9, 0x00, 0x3F, 0x90, 0x00,
+  0x0F, 0xF9, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x01,
+  0xB8, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA8, 0x00, 0x00,
+  0x00, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF8, 0x90, 0x00, 0x00, 0x3F, 0x90,
+  0x00, 0x0B, 0xFF, 0x90, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x00,
+  0x6F, 0xF8, 0x06, 0xFF, 0xE4, 0x2F, 0xFE, 0x40, 0x3F, 0xE4, 0x00, 0x0F, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x1A, 0xA9, 0x0B, 0xFF, 0xF4, 0xBE, 0xBF, 0xC5, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x02,
+  0xFC, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00,
+  0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x0B, 0xFA, 0xFF,
+  0x40, 0x07, 0xE4, 0x00, 0xBE, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x2E, 0x01, 0xA2, 0x87, 0xC3, 0xC0,
+  0xBF, 0xFD, 0x2D, 0x78, 0x2E, 0x5B, 0xD1, 0xEB, 0x43, 0xD0, 0x7D, 0x1E, 0xB4, 0x3C, 0x03, 0xD1,
+  0xEB, 0x43, 0xD0, 0x3D, 0x2D, 0xB4, 0x3E, 0x0B, 0xD7, 0xC7, 0x81, 0xFA, 0xFF, 0xF4, 0x3D, 0x07,
+  0xF7, 0xF8, 0x01, 0xF4, 0x04, 0x10, 0x00, 0x0B, 0xD0, 0x00, 0x60, 0x00, 0x2F, 0xE5, 0xAF, 0x40,
+  0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x3F, 0xF4,
+  0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x01, 0xFD, 0xBF,
+  0x00, 0x02, 0xF8, 0x7F, 0x40, 0x03, 0xF4, 0x3F, 0x80, 0x0B, 0xF0, 0x2F, 0xC0, 0x0F, 0xF5, 0x6F,
+  0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0x95, 0x57, 0xF4, 0x7F, 0x40, 0x03,
+  0xF8, 0xBF, 0x00, 0x02, 0xFD, 0x2A, 0xAA, 0x90, 0x1F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xF1, 0xFE,
+  0x03, 0xFD, 0x7F, 0x80, 0xBF, 0x5F, 0xE0, 0x2F, 0xC7, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xE4, 0x7F,
+  0xAA, 0xFF, 0x5F, 0xE0, 0x1F, 0xE7, 0xF8, 0x03, 0xF9, 0xFE, 0x01, 0xFE, 0x7F, 0xAA, 0xFF, 0x9F,
+  0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x40, 0x00, 0x6A, 0xA8, 0x01, 0xBF, 0xFF, 0xD1, 0xFF, 0xFF, 0xF8,
+  0xFF, 0x90, 0x1A, 0x7F, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x05, 0x2F, 0xFA, 0xAF,
+  0x82, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x2A, 0xAA, 0x50, 0x01, 0xFF, 0xFF,
+  0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xE5, 0x6F, 0xF4, 0x7F, 0x80, 0x1F, 0xF1, 0xFE, 0x00, 0x2F,
+  0xD7, 0xF8, 0x00, 0x7F, 0x9F, 0xE0, 0x01, 0xFE, 0x7F, 0x80, 0x07, 0xF9, 0xFE, 0x00, 0x2F, 0xD7,
+  0xF8, 0x01, 0xFF, 0x1F, 0xE0, 0x1F, 0xF8, 0x7F, 0xEB, 0xFF, 0x81, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
+  0xFA, 0x40, 0x00, 0x2A, 0xAA, 0xA8, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0x95, 0x54, 0x7F,
+  0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F, 0xEA, 0xA4, 0x7F, 0x80,
+  0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xEA, 0xA9, 0x7F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD,
+  0x2A, 0xAA, 0xA9, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xE5, 0x55, 0x7F, 0x80, 0x01, 0xFE, 0x00,
+  0x07, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x7F, 0xEA, 0xA5, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0,
+  0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x6F, 0xFF,
+  0xFD, 0x1F, 0xFF, 0xFF, 0xE3, 0xFE, 0x40, 0x1A, 0x7F, 0x80, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFB, 0xF0, 0x0A, 0xBF, 0xBF, 0x80, 0x0B,
+  0xF3, 0xFD, 0x00, 0xBF, 0x2F, 0xFA, 0xAF, 0xF0, 0xBF, 0xFF, 0xFF, 0x01, 0xBF, 0xFE, 0x80, 0x00,
+  0x55, 0x00, 0x2A, 0x40, 0x06, 0xA7, 0xF8, 0x00, 0xBF, 0x7F, 0x80, 0x0B, 0xF7, 0xF8, 0x00, 0xBF,
+  0x7F, 0x80, 0x0B, 0xF7, 0xF8, 0x00, 0xBF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xEA,
+  0xAF, 0xF7, 0xF8, 0x00, 0xBF, 0x7F, 0x80, 0x0B, 0xF7, 0xF8, 0x00, 0xBF, 0x7F, 0x80, 0x0B, 0xF7,
+  0xF8, 0x00, 0xBF, 0x7F, 0x80, 0x0B, 0xF0, 0x2A, 0x5F, 0xE7, 0xF9, 0xFE, 0x7F, 0x9F, 0xE7, 0xF9,
+  0xFE, 0x7F, 0x9F, 0xE7, 0xF9, 0xFE, 0x7F, 0x9F, 0xE7, 0xF8, 0x02, 0xA4, 0x1F, 0xE0, 0x7F, 0x81,
+  0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFE, 0x07,
+  0xF8, 0x1F, 0xE0, 0x7F, 0x82, 0xFD, 0xBF, 0xF3, 0xFF, 0x4F, 0xA0, 0x00, 0x2A, 0x40, 0x1A, 0xA1,
+  0xFE, 0x01, 0xFF, 0x47, 0xF8, 0x1F, 0xF4, 0x1F, 0xE1, 0xFF, 0x40, 0x7F, 0x9F, 0xF4, 0x01, 0xFE,
+  0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFE, 0xFF,
+  0x80, 0x07, 0xF9, 0xFF, 0x80, 0x1F, 0xE1, 0xFF, 0x80, 0x7F, 0x81, 0xFF, 0x81, 0xFE, 0x01, 0xFF,
+  0x87, 0xF8, 0x01, 0xFF, 0x80, 0x2A, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80,
+  0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00,
+  0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xEA, 0xA9, 0x7F, 0xFF, 0xFD, 0x7F,
+  0xFF, 0xFD, 0x2A, 0x90, 0x00, 0x6A, 0x9F, 0xFC, 0x00, 0x7F, 0xF7, 0xFF, 0x80, 0x2F, 0xFD, 0xFF,
+  0xF0, 0x0F, 0xFF, 0x7F, 0xFD, 0x0B, 0xFF, 0xDF, 0xEF, 0x83, 0xFB, 0xF7, 0xFA, 0xF5, 0xFA, 0xFD,
+  0xFE, 0x7E, 0xBC, 0xBF, 0x7F, 0x8B, 0xFE, 0x2F, 0xDF, 0xE1, 0xFF, 0x4B, 0xF7, 0xF8, 0x3F, 0xC2,
+  0xFD, 0xFE, 0x0B, 0xD0, 0xBF, 0x7F, 0x80, 0x50, 0x2F, 0xDF, 0xE0, 0x00, 0x0B, 0xF7, 0xF8, 0x00,
+  0x02, 0xFC, 0x2A, 0x80, 0x06, 0xA7, 0xFE, 0x00, 0xBF, 0x7F, 0xF0, 0x0B, 0xF7, 0xFF, 0x80, 0xBF,
+  0x7F, 0xFD, 0x0B, 0xF7, 0xFF, 0xE0, 0xBF, 0x7F, 0xAF, 0x4B, 0xF7, 0xF9, 0xF8, 0xBF, 0x7F, 0x8B,
+  0xDB, 0xF7, 0xF8, 0x7F, 0xBF, 0x7F, 0x82, 0xFF, 0xF7, 0xF8, 0x0F, 0xFF, 0x7F, 0x80, 0xBF, 0xF7,
+  0xF8, 0x03, 0xFF, 0x7F, 0x80, 0x2F, 0xF0, 0x00, 0x6A, 0xA4, 0x00, 0x1F, 0xFF, 0xFD, 0x01, 0xFF,
+  0xFF, 0xFD, 0x0F, 0xF8, 0x0B, 0xFC, 0x7F, 0x80, 0x0B, 0xF6, 0xFD, 0x00, 0x1F, 0xEF, 0xF0, 0x00,
+  0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xEB, 0xF4, 0x00, 0x7F,
+  0x9F, 0xF0, 0x03, 0xFD, 0x2F, 0xFA, 0xBF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0x90, 0x00,
+  0x01, 0x50, 0x00, 0x2A, 0xAA, 0x90, 0x1F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xF1, 0xFE, 0x56, 0xFE,
+  0x7F, 0x80, 0x3F, 0x9F, 0xE0, 0x0F, 0xE7, 0xF8, 0x0B, 0xF9, 0xFF, 0xAF, 0xFD, 0x7F, 0xFF, 0xFE,
+  0x1F, 0xFF, 0xE9, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00,
+  0x07, 0xF8, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFD, 0x0F,
+  0xF8, 0x0B, 0xFC, 0x7F, 0x80, 0x0B, 0xF6, 0xFD, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0,
+  0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xEB, 0xF4, 0x00, 0x7F, 0x9F, 0xF0, 0x03,
+  0xFD, 0x2F, 0xFA, 0xBF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x01, 0x6F, 0x80,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x2A, 0xAA, 0x90, 0x07, 0xFF, 0xFF, 0x80, 0x7F,
+  0xFF, 0xFE, 0x07, 0xF9, 0x5F, 0xF0, 0x7F, 0x80, 0xBF, 0x47, 0xF8, 0x0B, 0xF0, 0x7F, 0x81, 0xFE,
+  0x07, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF4, 0x07, 0xFA, 0xBF, 0xD0, 0x7F, 0x81, 0xFE, 0x07, 0xF8,
+  0x0B, 0xF4, 0x7F, 0x80, 0x7F, 0x87, 0xF8, 0x02, 0xFD, 0x7F, 0x80, 0x1F, 0xE0, 0x02, 0xAA, 0xA4,
+  0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x7F, 0x40, 0x18, 0xBE, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x7F,
+  0xFE, 0x90, 0x1F, 0xFF, 0xF8, 0x06, 0xFF, 0xFE, 0x00, 0x06, 0xFE, 0x00, 0x00, 0xBF, 0x60, 0x00,
+  0xBF, 0xBE, 0xAA, 0xFE, 0xBF, 0xFF, 0xFC, 0x2B, 0xFF, 0xE4, 0x00, 0x55, 0x00, 0xAA, 0xAA, 0xAA,
+  0x9F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xE5, 0x57, 0xF9, 0x54, 0x00, 0x3F, 0x80, 0x00, 0x03,
+  0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00,
+  0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFE, 0x7F, 0x80, 0x1F, 0xE7, 0xF8, 0x01, 0xFE,
+  0x7F, 0x80, 0x1F, 0xE7, 0xF8, 0x01, 0xFE, 0x7F, 0x80, 0x1F, 0xE7, 0xF8, 0x01, 0xFE, 0x7F, 0x80,
+  0x1F, 0xE7, 0xF8, 0x01, 0xFE, 0x3F, 0x80, 0x2F, 0xD3, 0xFC, 0x02, 0xFC, 0x2F, 0xFA, 0xBF, 0x80,
+  0xBF, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x6A, 0x00, 0x01, 0xAA, 0xFD, 0x00,
+  0x0B, 0xF3, 0xF8, 0x00, 0x3F, 0x8B, 0xF0, 0x02, 0xFD, 0x1F, 0xD0, 0x0F, 0xF0, 0x3F, 0x80, 0x7F,
+  0x80, 0xBF, 0x02, 0xFC, 0x01, 0xFD, 0x0F, 0xE0, 0x03, 0xF8, 0x7F, 0x40, 0x0B, 0xF2, 0xFC, 0x00,
+  0x0F, 0xEF, 0xE0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x02,
+  0xFF, 0x00, 0x00, 0xA8, 0x00, 0x6A, 0x00, 0x2A, 0x7F, 0x40, 0x3F, 0xC0, 0x1F, 0xDF, 0xE0, 0x1F,
+  0xF4, 0x0B, 0xF2, 0xFC, 0x0B, 0xFE, 0x03, 0xF8, 0x7F, 0x42, 0xFB, 0x80, 0xFE, 0x1F, 0xD0, 0xFA,
+  0xF0, 0x7F, 0x43, 0xF8, 0x7D, 0x7D, 0x2F, 0xC0, 0xBF, 0x1F, 0x4F, 0x8B, 0xE0, 0x2F, 0xCB, 0xC3,
+  0xE3, 0xF8, 0x07, 0xF7, 0xE0, 0xBD, 0xFD, 0x00, 0xFE, 0xF4, 0x1F, 0xBF, 0x00, 0x2F, 0xFD, 0x07,
+  0xFF, 0x80, 0x0B, 0xFF, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0x80, 0x2F, 0xF4, 0x00, 0x3F, 0xE0, 0x07,
+  0xFC, 0x00, 0x2A, 0x40, 0x06, 0xA4, 0xBF, 0x40, 0x2F, 0xC0, 0xFF, 0x02, 0xFD, 0x01, 0xFE, 0x1F,
+  0xE0, 0x02, 0xFD, 0xFF, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00,
+  0x00, 0x7F, 0xF8, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x2F, 0xDF, 0xF0, 0x01, 0xFE, 0x1F, 0xE0, 0x0F,
+  0xF0, 0x2F, 0xD0, 0xBF, 0x40, 0x3F, 0xC7, 0xF8, 0x00, 0x7F, 0x80, 0xAA, 0x00, 0x06, 0xA6, 0xFE,
+  0x00, 0x3F, 0xC2, 0xFD, 0x02, 0xFD, 0x07, 0xFC, 0x1F, 0xE0, 0x0B, 0xF8, 0xFF, 0x00, 0x0B, 0xFB,
+  0xF4, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0x00,
+  0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
+  0x02, 0xFC, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF5, 0x55, 0x5B,
+  0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFE,
+  0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xEA, 0xAA, 0x7F, 0xFF,
+  0xFF, 0xEF, 0xFF, 0xFF, 0xF8, 0x15, 0x55, 0xFF, 0xE7, 0xFF, 0x9F, 0xC0, 0x7F, 0x01, 0xFC, 0x07,
+  0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F,
+  0xC0, 0x7F, 0xA5, 0xFF, 0xE6, 0xAA, 0x80, 0x60, 0x02, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x2D, 0x00,
+  0x78, 0x00, 0xF0, 0x02, 0xD0, 0x07, 0x80, 0x0F, 0x00, 0x3D, 0x00, 0xB8, 0x01, 0xF0, 0x03, 0xD0,
+  0x0B, 0x80, 0x1F, 0x00, 0x28, 0x55, 0x52, 0xFF, 0xEB, 0xFF, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0,
+  0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80,
+  0xFE, 0x6B, 0xFA, 0xFF, 0xEA, 0xAA, 0x40, 0x00, 0x29, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xFE,
+  0x00, 0x2F, 0x8B, 0xE0, 0x2F, 0x40, 0xBD, 0x1A, 0x00, 0x06, 0x90, 0x55, 0x55, 0x5F, 0xFF, 0xFF,
+  0xAA, 0xAA, 0xA0, 0xBC, 0x02, 0xE0, 0x0B, 0x80, 0x29, 0x00, 0x15, 0x00, 0x1B, 0xFF, 0xE4, 0x1F,
+  0xFF, 0xFC, 0x19, 0x55, 0xFE, 0x00, 0x00, 0xBE, 0x06, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0x90,
+  0xBF, 0x7F, 0x80, 0xBF, 0x3F, 0x82, 0xFF, 0x2F, 0xFF, 0xBF, 0x0B, 0xFD, 0xBF, 0x00, 0x50, 0x00,
+  0x15, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x41, 0x00,
+  0x1F, 0xDB, 0xFD, 0x07, 0xFB, 0xFF, 0xD1, 0xFF, 0x9B, 0xF8, 0x7F, 0x80, 0xBF, 0x5F, 0xD0, 0x1F,
+  0xD7, 0xF4, 0x07, 0xF9, 0xFD, 0x01, 0xFD, 0x7F, 0x80, 0xBF, 0x5F, 0xF9, 0xBF, 0xC7, 0xFF, 0xFF,
+  0xD1, 0xFD, 0xBF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x00, 0x06, 0xFF, 0xD0, 0xBF, 0xFF,
+  0x87, 0xFD, 0x5A, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0,
+  0x00, 0xBF, 0xD5, 0xA0, 0xBF, 0xFF, 0x80, 0xBF, 0xFD, 0x00, 0x05, 0x40, 0x00, 0x00, 0x55, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x40, 0xFE, 0x0B, 0xF8, 0xFE, 0x2F, 0xFF,
+  0xFE, 0xBF, 0x97, 0xFE, 0xFF, 0x01, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE,
+  0xFF, 0x01, 0xFE, 0xBF, 0x97, 0xFE, 0x3F, 0xFF, 0xFE, 0x0B, 0xFD, 0xFE, 0x01, 0x50, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0xBF, 0xFF, 0xD0, 0x7F, 0x96, 0xFC, 0x3F, 0x80, 0x3F, 0x4F,
+  0xFA, 0xAF, 0xE7, 0xFF, 0xFF, 0xF8, 0xFE, 0xAA, 0xA9, 0x3F, 0x80, 0x00, 0x0B, 0xF8, 0x06, 0xC0,
+  0xBF, 0xFF, 0xF0, 0x0B, 0xFF, 0xE8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x15, 0x40, 0xBF, 0xF0, 0xBF,
+  0xFC, 0x2F, 0xC0, 0x0F, 0xE0, 0x2F, 0xFF, 0xEB, 0xFF, 0xF9, 0xBF, 0xA9, 0x0F, 0xE0, 0x03, 0xF8,
+  0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x40,
+  0x00, 0x0B, 0xF8, 0xFE, 0x2F, 0xFF, 0xFE, 0xBF, 0x97, 0xFE, 0xFF, 0x01, 0xFE, 0xFE, 0x00, 0xFE,
+  0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xBF, 0x01, 0xFE, 0x7F, 0xEB, 0xFE, 0x2F, 0xFE, 0xFE, 0x0B,
+  0xF8, 0xFE, 0x00, 0x00, 0xFD, 0x24, 0x06, 0xFC, 0x2F, 0xFF, 0xF4, 0x2F, 0xFF, 0x90, 0x01, 0x54,
+  0x00, 0x15, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x41, 0x40,
+  0x7F, 0x6F, 0xF4, 0x7F, 0xBF, 0xFC, 0x7F, 0xEA, 0xFD, 0x7F, 0x80, 0xFE, 0x7F, 0x40, 0xBE, 0x7F,
+  0x40, 0xBE, 0x7F, 0x40, 0xBE, 0x7F, 0x40, 0xBE, 0x7F, 0x40, 0xBE, 0x7F, 0x40, 0xBE, 0x7F, 0x40,
+  0xBE, 0x15, 0x1F, 0xD7, 0xF5, 0xA9, 0x00, 0x1F, 0xD7, 0xF5, 0xFD, 0x7F, 0x5F, 0xD7, 0xF5, 0xFD,
+  0x7F, 0x5F, 0xD7, 0xF5, 0xFD, 0x01, 0x50, 0x1F, 0xD0, 0x7F, 0x41, 0xA9, 0x00, 0x00, 0x1F, 0xD0,
+  0x7F, 0x41, 0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x41, 0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x41,
+  0xFD, 0x07, 0xF4, 0x2F, 0xCB, 0xFE, 0x2F, 0xE0, 0x54, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xD0, 0x00,
+  0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x7F, 0x87, 0xF4, 0x7F,
+  0x81, 0xFD, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xFD,
+  0x00, 0x7F, 0x6F, 0xD0, 0x1F, 0xD2, 0xFD, 0x07, 0xF4, 0x2F, 0xD1, 0xFD, 0x07, 0xFD, 0x15, 0x1F,
+  0xD7, 0xF5, 0xFD, 0x7F, 0x5F, 0xD7, 0xF5, 0xFD, 0x7F, 0x5F, 0xD7, 0xF5, 0xFD, 0x7F, 0x5F, 0xD7,
+  0xF5, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x01, 0xFD, 0xBF, 0x82, 0xFE, 0x07, 0xFF, 0xFF, 0xAF, 0xFE,
+  0x1F, 0xFA, 0xFF, 0xEB, 0xFC, 0x7F, 0x81, 0xFE, 0x07, 0xF5, 0xFD, 0x07, 0xF4, 0x1F, 0xD7, 0xF4,
+  0x1F, 0xD0, 0x7F, 0x5F, 0xD0, 0x7F, 0x41, 0xFD, 0x7F, 0x41, 0xFD, 0x07, 0xF5, 0xFD, 0x07, 0xF4,
+  0x1F, 0xD7, 0xF4, 0x1F, 0xD0, 0x7F, 0x5F, 0xD0, 0x7F, 0x41, 0xFD, 0x00, 0x01, 0x40, 0x7F, 0x6F,
+  0xF4, 0x7F, 0xBF, 0xFC, 0x7F, 0xEA, 0xFD, 0x7F, 0x80, 0xFE, 0x7F, 0x40, 0xBE, 0x7F, 0x40, 0xBE,
+  0x7F, 0x40, 0xBE, 0x7F, 0x40, 0xBE, 0x7F, 0x40, 0xBE, 0x7F, 0x40, 0xBE, 0x7F, 0x40, 0xBE, 0x00,
+  0x05, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0xBF, 0xFF, 0xD0, 0x7F, 0x97, 0xFC, 0x3F, 0xC0, 0x3F, 0x8F,
+  0xE0, 0x0B, 0xE7, 0xF8, 0x02, 0xF8, 0xFE, 0x00, 0xBE, 0x3F, 0xC0, 0x3F, 0x8B, 0xF9, 0x6F, 0xD0,
+  0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1F, 0xDB, 0xFD,
+  0x07, 0xFB, 0xFF, 0xD1, 0xFF, 0x9B, 0xF8, 0x7F, 0x80, 0xBF, 0x5F, 0xD0, 0x1F, 0xD7, 0xF4, 0x07,
+  0xF9, 0xFD, 0x01, 0xFD, 0x7F, 0x80, 0xBF, 0x5F, 0xF9, 0xBF, 0xC7, 0xFF, 0xFF, 0xD1, 0xFD, 0xBF,
+  0xD0, 0x7F, 0x41, 0x40, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x0B, 0xF8, 0xFE, 0x2F, 0xFF, 0xFE, 0xBF, 0x97, 0xFE, 0xFF, 0x01,
+  0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0xFE, 0xFF, 0x01, 0xFE, 0xBF, 0x97, 0xFE,
+  0x3F, 0xFF, 0xFE, 0x0B, 0xFD, 0xFE, 0x01, 0x50, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0x55, 0x00, 0x01, 0x5F, 0xDB, 0xE7, 0xFB, 0xF9, 0xFF, 0xEA, 0x7F, 0xC0,
+  0x1F, 0xD0, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0x7F, 0x40, 0x1F, 0xD0, 0x07, 0xF4, 0x01, 0xFD, 0x00,
+  0x00, 0x50, 0x02, 0xFF, 0xF8, 0xBF, 0xFF, 0xDF, 0xE5, 0x59, 0xFD, 0x00, 0x0B, 0xFE, 0x90, 0x7F,
+  0xFF, 0xD0, 0x6B, 0xFE, 0x00, 0x0B, 0xFA, 0x40, 0xBF, 0xBF, 0xFF, 0xEB, 0xFF, 0xF8, 0x01, 0x54,
+  0x00, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x02, 0xFF, 0xFF, 0xBF, 0xFF, 0xDB, 0xFA, 0xA0, 0xFE,
+  0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0xE9, 0x0B, 0xFF, 0x80, 0xBF,
+  0xE0, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFE,
+  0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFE, 0x7F, 0x41, 0xFE, 0x7F, 0x9B, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F,
+  0xF8, 0xFE, 0x01, 0x50, 0x00, 0xBF, 0x00, 0x3F, 0x8F, 0xD0, 0x1F, 0xD2, 0xF8, 0x0B, 0xE0, 0x7F,
+  0x03, 0xF4, 0x0F, 0xD1, 0xFC, 0x02, 0xF8, 0xBE, 0x00, 0x3F, 0x7F, 0x40, 0x0B, 0xFF, 0x80, 0x01,
+  0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0x41, 0xF8, 0x0B, 0xE3, 0xF4, 0x2F,
+  0xC0, 0xFD, 0x2F, 0x82, 0xFD, 0x1F, 0xC1, 0xFC, 0x3F, 0xE1, 0xFC, 0x0F, 0xD7, 0xEE, 0x2F, 0x80,
+  0xFD, 0xB9, 0xF3, 0xF4, 0x0B, 0xEB, 0x8F, 0xBF, 0x00, 0x7F, 0xF4, 0xBF, 0xE0, 0x03, 0xFF, 0x0B,
+  0xFE, 0x00, 0x2F, 0xE0, 0x7F, 0xD0, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0xBF, 0x07, 0xF4,
+  0x7F, 0x40, 0xBE, 0x3F, 0x80, 0x0F, 0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x1F,
+  0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x0B, 0xE2, 0xF8, 0x0B, 0xF0, 0x7F, 0x87, 0xF4, 0x07, 0xF4, 0xBF,
+  0x00, 0x3F, 0x8F, 0xD0, 0x1F, 0xC2, 0xF8, 0x0B, 0xE0, 0x7F, 0x03, 0xF4, 0x0F, 0xE1, 0xFC, 0x01,
+  0xFC, 0xBE, 0x00, 0x3F, 0x7F, 0x40, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xF0, 0x00,
+  0x07, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x00,
+  0x15, 0x00, 0x00, 0xBF, 0xFF, 0xEB, 0xFF, 0xFE, 0x6A, 0xAF, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00,
+  0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0xFF, 0xAA, 0x9F, 0xFF, 0xFE, 0xFF, 0xFF, 0xE0, 0x00,
+  0x01, 0x50, 0x07, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x2F, 0x80, 0x02, 0xF8,
+  0x00, 0x2F, 0x80, 0x07, 0xF8, 0x0B, 0xFF, 0x40, 0xBF, 0xE0, 0x01, 0x7F, 0x80, 0x02, 0xF8, 0x00,
+  0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xE0, 0x00,
+  0x55, 0x16, 0xEB, 0xAE, 0xBA, 0xEB, 0xAE, 0xBA, 0xEB, 0xAE, 0xBA, 0xEB, 0xAE, 0xBA, 0xEB, 0xAE,
+  0x68, 0x15, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80,
+  0x02, 0xF8, 0x00, 0x2F, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x1F, 0xE5, 0x02,
+  0xFC, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x0B, 0xFF, 0x40, 0xBF, 0xE0,
+  0x01, 0x50, 0x00, 0x2F, 0xE4, 0x02, 0xBF, 0xFF, 0xEB, 0xEE, 0x56, 0xFF, 0xE5, 0x00, 0x06, 0x90,
+};
+
+static constexpr AAGlyph FontSansBold20Glyphs[] = {
+  {    0,  0,  0,   0,   0,  7 },  // ' '
+  {    0,  5, 15,   2, -15,  9 },  // '!'
+  {   19,  7,  6,   2, -15, 10 },  // '"'
+  {   30, 15, 15,   1, -15, 17 },  // '#'
+  {   87, 12, 19,   1, -16, 14 },  // '$'
+  {  144, 20, 16,   0, -15, 20 },  // '%'
+  {  224, 16, 16,   1, -15, 17 },  // '&'
+  {  288,  3,  6,   2, -15,  6 },  // '\''
+  {  293,  7, 19,   1, -16,  9 },  // '('
+  {  327,  7, 19,   1, -16,  9 },  // ')'
+  {  361, 10, 10,   0, -15, 10 },  // '*'
+  {  386, 13, 13,   2, -13, 17 },  // '+'
+  {  429,  5,  7,   1,  -4,  8 },  // ','
+  {  438,  7,  4,   1,  -8,  8 },  // '-'
+  {  445,  4,  4,   2,  -4,  8 },  // '.'
+  {  449,  7, 17,   0, -15,  7 },  // '/'
+  {  479, 12, 16,   1, -15, 14 },  // '0'
+  {  527, 11, 15,   2, -15, 14 },  // '1'
+  {  569, 12, 15,   1, -15, 14 },  // '2'
+  {  614, 12, 16,   1, -15, 14 },  // '3'
+  {  662, 12, 15,   1, -15, 14 },  // '4'
+  {  707, 12, 16,   1, -15, 14 },  // '5'
+  {  755, 12, 16,   1, -15, 14 },  // '6'
+  {  803, 12, 15,   1, -15, 14 },  // '7'
+  {  848, 12, 16,   1, -15, 14 },  // '8'
+  {  896, 12, 16,   1, -15, 14 },  // '9'
+  {  944,  4, 11,   2, -11,  8 },  // ':'
+  {  955,  5, 14,   1, -11,  8 },  // ';'
+  {  973, 13, 12,   2, -12, 17 },  // '<'
+  { 1012, 13,  7,   2, -10, 17 },  // '='
+  { 1035, 13, 12,   2, -12, 17 },  // '>'
+  { 1074, 10, 15,   1, -15, 12 },  // '?'
+  { 1112, 18, 18,   1, -14, 20 },  // '@'
+  { 1193, 16, 15,   0, -15, 15 },  // 'A'
+  { 1253, 13, 15,   1, -15, 15 },  // 'B'
+  { 1302, 13, 16,   1, -15, 15 },  // 'C'
+  { 1354, 15, 15,   1, -15, 17 },  // 'D'
+  { 1411, 12, 15,   1, -15, 14 },  // 'E'
+  { 1456, 11, 15,   1, -15, 14 },  // 'F'
+  { 1498, 14, 16,   1, -15, 16 },  // 'G'
+  { 1554, 14, 15,   1, -15, 17 },  // 'H'
+  { 1607,  5, 15,   1, -15,  7 },  // 'I'
+  { 1626,  7, 19,  -1, -15,  7 },  // 'J'
+  { 1660, 15, 15,   1, -15, 15 },  // 'K'
+  { 1717, 12, 15,   1, -15, 13 },  // 'L'
+  { 1762, 17, 15,   1, -15, 20 },  // 'M'
+  { 1826, 14, 15,   1, -15, 17 },  // 'N'
+  { 1879, 15, 16,   1, -15, 17 },  // 'O'
+  { 1939, 13, 15,   1, -15, 15 },  // 'P'
+  { 1988, 15, 18,   1, -15, 17 },  // 'Q'
+  { 2056, 14, 15,   1, -15, 15 },  // 'R'
+  { 2109, 12, 16,   1, -15, 14 },  // 'S'
+  { 2157, 14, 15,   0, -15, 14 },  // 'T'
+  { 2210, 14, 16,   1, -15, 16 },  // 'U'
+  { 2266, 15, 15,   0, -15, 15 },  // 'V'
+  { 2323, 21, 15,   1, -15, 22 },  // 'W'
+  { 2402, 15, 15,   0, -15, 15 },  // 'X'
+  { 2459, 15, 15,   0, -15, 14 },  // 'Y'
+  { 2516, 13, 15,   1, -15, 15 },  // 'Z'
+  { 2565,  7, 19,   1, -16,  9 },  // '['
+  { 2599,  7, 17,   0, -15,  7 },  // '\\'
+  { 2629,  7, 19,   1, -16,  9 },  // ']'
+  { 2663, 13,  6,   2, -15, 17 },  // '^'
+  { 2683, 10,  3,   0,   2, 10 },  // '_'
+  { 2691,  6,  4,   1, -16, 10 },  // '`'
+  { 2697, 12, 13,   0, -12, 13 },  // 'a'
+  { 2736, 13, 17,   1, -16, 14 },  // 'b'
+  { 2792, 11, 13,   0, -12, 12 },  // 'c'
+  { 2828, 12, 17,   1, -16, 14 },  // 'd'
+  { 2879, 13, 13,   0, -12, 14 },  // 'e'
+  { 2922,  9, 16,   0, -16,  9 },  // 'f'
+  { 2958, 12, 17,   1, -12, 14 },  // 'g'
+  { 3009, 12, 16,   1, -16, 14 },  // 'h'
+  { 3057,  5, 16,   1, -16,  7 },  // 'i'
+  { 3077,  7, 21,  -1, -16,  7 },  // 'j'
+  { 3114, 13, 16,   1, -16, 13 },  // 'k'
+  { 3166,  5, 16,   1, -16,  7 },  // 'l'
+  { 3186, 19, 12,   1, -12, 21 },  // 'm'
+  { 3243, 12, 12,   1, -12, 14 },  // 'n'
+  { 3279, 13, 13,   0, -12, 14 },  // 'o'
+  { 3322, 13, 17,   1, -12, 14 },  // 'p'
+  { 3378, 12, 17,   1, -12, 14 },  // 'q'
+  { 3429,  9, 12,   1, -12, 10 },  // 'r'
+  { 3456, 10, 13,   1, -12, 12 },  // 's'
+  { 3489,  9, 14,   0, -14, 10 },  // 't'
+  { 3521, 12, 12,   1, -11, 14 },  // 'u'
+  { 3557, 13, 11,   0, -11, 13 },  // 'v'
+  { 3593, 18, 11,   0, -11, 18 },  // 'w'
+  { 3643, 13, 11,   0, -11, 13 },  // 'x'
+  { 3679, 13, 16,   0, -11, 13 },  // 'y'
+  { 3731, 10, 11,   1, -11, 12 },  // 'z'
+  { 3759, 10, 20,   2, -16, 14 },  // '{'
+  { 3809,  3, 21,   2, -16,  7 },  // '|'
+  { 3825, 10, 20,   2, -16, 14 },  // '}'
+  { 3875, 13,  4,   2,  -8, 17 },  // '~'
+};
+
+static constexpr AAFont FontSansBold20 = {
+  FontSansBold20Bitmap, FontSansBold20Glyphs, 0x20, 0x7E, 23, 19, 2
+};
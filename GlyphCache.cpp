@@ -0,0 +1,144 @@
+#include "GlyphCache.h"
+#include "esp_heap_caps.h"
+
+GlyphCache::GlyphCache() {
+  memset(entries, 0, sizeof(entries));
+  budget = 0;
+  used = 0;
+  tick = 0;
+  hits = 0;
+  misses = 0;
+  evictions = 0;
+}
+
+bool GlyphCache::begin(uint32_t budgetBytes) {
+  clear();
+  budget = budgetBytes;
+  return budget > 0;
+}
+
+void GlyphCache::end() {
+  clear();
+  budget = 0;
+}
+
+uint64_t GlyphCache::makeKey(uint8_t c, uint16_t fg, uint16_t bg, uint8_t size) {
+  return ((uint64_t)size << 40) | ((uint64_t)c << 32) | ((uint32_t)fg << 16) | bg;
+}
+
+uint8_t GlyphCache::setOf(uint64_t key) {
+  // Mezclar carácter y colores para repartir "ON"/"OFF" de un mismo botón
+  uint32_t h = (uint32_t)key ^ (uint32_t)(key >> 32) * 0x9E3779B1u;
+  h ^= h >> 15;
+  return h % GLYPH_CACHE_SETS;
+}
+
+const uint16_t* GlyphCache::lookup(uint8_t c, uint16_t fg, uint16_t bg, uint8_t size) {
+  if (!budget) return nullptr;
+  uint64_t key = makeKey(c, fg, bg, size);
+  Entry* set = entries[setOf(key)];
+  for (int i = 0; i < GLYPH_CACHE_WAYS; i++) {
+    if (set[i].pixels && set[i].key == key) {
+      set[i].lastUse = ++tick;
+      hits++;
+      return set[i].pixels;
+    }
+  }
+  misses++;
+  return nullptr;
+}
+
+const uint16_t* GlyphCache::peek(uint8_t c, uint16_t fg, uint16_t bg, uint8_t size) {
+  if (!budget) return nullptr;
+  uint64_t key = makeKey(c, fg, bg, size);
+  Entry* set = entries[setOf(key)];
+  for (int i = 0; i < GLYPH_CACHE_WAYS; i++) {
+    if (set[i].pixels && set[i].key == key) return set[i].pixels;
+  }
+  return nullptr;
+}
+
+uint16_t* GlyphCache::insert(uint8_t c, uint16_t fg, uint16_t bg, uint8_t size, uint32_t pixels) {
+  uint32_t bytes = pixels * sizeof(uint16_t);
+  if (!budget || bytes > budget) return nullptr;
+
+  uint64_t key = makeKey(c, fg, bg, size);
+  Entry* set = entries[setOf(key)];
+
+  // Hueco libre del conjunto o, si no hay, su entrada menos usada
+  Entry* slot = &set[0];
+  for (int i = 0; i < GLYPH_CACHE_WAYS; i++) {
+    if (!set[i].pixels) {
+      slot = &set[i];
+      break;
+    }
+    if (set[i].lastUse < slot->lastUse) slot = &set[i];
+  }
+  if (slot->pixels) evict(*slot);
+
+  while (used + bytes > budget) evictOldest();
+
+  uint16_t* mem = (uint16_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!mem) mem = (uint16_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!mem) return nullptr;
+
+  slot->key = key;
+  slot->pixels = mem;
+  slot->bytes = bytes;
+  slot->lastUse = ++tick;
+  used += bytes;
+  return mem;
+}
+
+void GlyphCache::evict(Entry& e) {
+  heap_caps_free(e.pixels);
+  used -= e.bytes;
+  e.pixels = nullptr;
+  e.bytes = 0;
+  evictions++;
+}
+
+void GlyphCache::evictOldest() {
+  Entry* oldest = nullptr;
+  for (int s = 0; s < GLYPH_CACHE_SETS; s++) {
+    for (int i = 0; i < GLYPH_CACHE_WAYS; i++) {
+      Entry& e = entries[s][i];
+      if (e.pixels && (!oldest || e.lastUse < oldest->lastUse)) oldest = &e;
+    }
+  }
+  if (oldest) evict(*oldest);
+}
+
+void GlyphCache::clear() {
+  for (int s = 0; s < GLYPH_CACHE_SETS; s++) {
+    for (int i = 0; i < GLYPH_CACHE_WAYS; i++) {
+      Entry& e = entries[s][i];
+      if (e.pixels) heap_caps_free(e.pixels);
+      e.pixels = nullptr;
+      e.bytes = 0;
+    }
+  }
+  used = 0;
+}
+
+GlyphCacheStats GlyphCache::getStats() {
+  GlyphCacheStats st;
+  st.hits = hits;
+  st.misses = misses;
+  st.evictions = evictions;
+  st.entries = 0;
+  for (int s = 0; s < GLYPH_CACHE_SETS; s++) {
+    for (int i = 0; i < GLYPH_CACHE_WAYS; i++) {
+      if (entries[s][i].pixels) st.entries++;
+    }
+  }
+  st.bytesUsed = used;
+  st.bytesBudget = budget;
+  return st;
+}
+
+void GlyphCache::resetStats() {
+  hits = 0;
+  misses = 0;
+  evictions = 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file GlyphCache.h
+ * @brief Caché LRU de glifos ya rasterizados en RGB565.
+ */
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <Arduino.h>
+
+/** Conjuntos (cubetas) de la caché; cada uno guarda GLYPH_CACHE_WAYS glifos. */
+#define GLYPH_CACHE_SETS 16
+#define GLYPH_CACHE_WAYS 4
+
+/** Contadores de uso de la caché de glifos. */
+struct GlyphCacheStats {
+    uint32_t hits;         // Búsquedas resueltas desde la caché
+    uint32_t misses;       // Glifos que hubo que rasterizar
+    uint32_t evictions;    // Glifos descartados por falta de sitio o de memoria
+    uint32_t entries;      // Glifos guardados ahora
+    uint32_t bytesUsed;    // Memoria ocupada por los glifos guardados
+    uint32_t bytesBudget;  // Límite configurado en begin()
+};
+
+/**
+ * @class GlyphCache
+ * @brief Guarda celdas de caracteres ya escaladas y coloreadas.
+ *
+ * La clave es (carácter, color de texto, color de fondo, tamaño). La caché no
+ * sabe dibujar: insert() devuelve memoria que el llamador rellena. Es
+ * asociativa por conjuntos (búsqueda en GLYPH_CACHE_WAYS entradas) y descarta
+ * la entrada menos usada del conjunto, o la más antigua de toda la caché si
+ * se supera el presupuesto de memoria. Usa PSRAM si existe.
+ */
+class GlyphCache {
+public:
+    GlyphCache();
+
+    /**
+     * @brief Activa la caché con un presupuesto de memoria en bytes.
+     * @return false si budgetBytes es 0.
+     */
+    bool begin(uint32_t budgetBytes);
+    /** @brief Libera todos los glifos y desactiva la caché. */
+    void end();
+    /** @brief Indica si la caché está activa. */
+    bool isEnabled() { return budget > 0; }
+
+    /** @brief Busca una celda; devuelve nullptr si no está. Cuenta acierto/fallo. */
+    const uint16_t* lookup(uint8_t c, uint16_t fg, uint16_t bg, uint8_t size);
+    /** @brief Como lookup() pero sin tocar contadores ni orden LRU (uso por filas). */
+    const uint16_t* peek(uint8_t c, uint16_t fg, uint16_t bg, uint8_t size);
+    /**
+     * @brief Reserva sitio para una celda de `pixels` colores.
+     * @return Memoria a rellenar, o nullptr si no cabe en el presupuesto.
+     */
+    uint16_t* insert(uint8_t c, uint16_t fg, uint16_t bg, uint8_t size, uint32_t pixels);
+    /** @brief Descarta todos los glifos guardados (mantiene el presupuesto). */
+    void clear();
+
+    /** @brief Devuelve los contadores acumulados. */
+    GlyphCacheStats getStats();
+    /** @brief Pone a cero aciertos, fallos y descartes. */
+    void resetStats();
+
+private:
+    struct Entry {
+        uint64_t key;
+        uint16_t* pixels;   // nullptr: entrada libre
+        uint32_t bytes;
+        uint32_t lastUse;
+    };
+
+    Entry entries[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS];
+    uint32_t budget;
+    uint32_t used;
+    uint32_t tick;
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+
+    static uint64_t makeKey(uint8_t c, uint16_t fg, uint16_t bg, uint8_t size);
+    static uint8_t setOf(uint64_t key);
+    void evict(Entry& e);
+    void evictOldest();
+};
+
+#endif // GLYPH_CACHE_H
@@ -0,0 +1,56 @@
+/**
+ * @file LatestValue.h
+ * @brief Último valor publicado por una tarea para otra (triple buffer).
+ *
+ * El productor escribe en su copia y la publica intercambiándola con la
+ * intermedia; el consumidor se queda con la intermedia si hay una nueva.
+ * Ninguno espera ni ve un valor a medio escribir, y el último publicado nunca
+ * se pierde: sólo se saltan los intermedios que nadie llegó a leer, que es lo
+ * que quiere un estado de pantalla. Un productor y un consumidor.
+ *
+ *     slot.back() = valor;   // productor
+ *     slot.publish();
+ *     if (slot.update()) usar(slot.front());   // consumidor
+ */
+#ifndef LATEST_VALUE_H
+#define LATEST_VALUE_H
+
+#include <Arduino.h>
+#include <atomic>
+
+template <typename T>
+class LatestValue {
+public:
+    LatestValue() : backIndex(0), middle(1), frontIndex(2) {}
+
+    /** @brief Copia que prepara el productor; no la ve nadie hasta publish(). */
+    T& back() { return slots[backIndex]; }
+    /** @brief Hace visible back() al consumidor (sólo el productor). */
+    void publish() {
+        backIndex = middle.exchange(backIndex | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+    void publish(const T& value) {
+        back() = value;
+        publish();
+    }
+
+    /** @brief Toma el último valor publicado (sólo el consumidor). @return false si no había otro nuevo. */
+    bool update() {
+        if (!(middle.load(std::memory_order_relaxed) & FRESH)) return false;
+        frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+    /** @brief Último valor tomado con update(). */
+    const T& front() const { return slots[frontIndex]; }
+
+private:
+    static const uint8_t INDEX_MASK = 0x03;
+    static const uint8_t FRESH = 0x04;   // La intermedia no la leyó el consumidor
+
+    T slots[3];
+    uint8_t backIndex;            // Sólo el productor
+    std::atomic<uint8_t> middle;  // Índice de la intermedia | FRESH
+    uint8_t frontIndex;           // Sólo el consumidor
+};
+
+#endif // LATEST_VALUE_H
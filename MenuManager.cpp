@@ -1,6 +1,7 @@
 #include "MenuManager.h"
 #include "PedalboardUI.h"
 #include "ConfigManager.h"
+#include "ButtonManager.h"
 
 
 MenuManager menuManager;
@@ -9,76 +10,170 @@ MenuManager menuManager;
 int globalBrightness = 255;
 int bleEnabled = 1;
 
+// ---------------------------------------------------------------------------
+// Getters / setters de los ítems
+// ---------------------------------------------------------------------------
+
+// Campos de MidiButtonConfig editables (arg de los ítems de un botón)
+enum ButtonField : uint8_t {
+    FIELD_TYPE,
+    FIELD_MIDI_TYPE,
+    FIELD_VALUE,
+    FIELD_CHANNEL,
+    FIELD_VELOCITY,
+    FIELD_ENABLED
+};
+
+static int getButtonField(uint8_t button, uint8_t field) {
+    MidiButtonConfig cfg = configManager.getButtonConfig(button);
+    switch (field) {
+        case FIELD_TYPE:      return cfg.type;
+        case FIELD_MIDI_TYPE: return cfg.midiType;
+        case FIELD_VALUE:     return cfg.value;
+        case FIELD_CHANNEL:   return cfg.channel;
+        case FIELD_VELOCITY:  return cfg.velocity;
+        case FIELD_ENABLED:   return cfg.enabled;
+    }
+    return 0;
+}
+
+static void setButtonField(uint8_t button, uint8_t field, int value) {
+    MidiButtonConfig cfg = configManager.getButtonConfig(button);
+    switch (field) {
+        case FIELD_TYPE:      cfg.type = value; break;
+        case FIELD_MIDI_TYPE: cfg.midiType = value; break;
+        case FIELD_VALUE:     cfg.value = value; break;
+        case FIELD_CHANNEL:   cfg.channel = value; break;
+        case FIELD_VELOCITY:  cfg.velocity = value; break;
+        case FIELD_ENABLED:   cfg.enabled = value; break;
+    }
+    configManager.saveButtonConfig(button, cfg); // Banco actual, persiste en NVS
+}
+
+// Banco mostrado desde 1
+static int getBank(uint8_t, uint8_t) {
+    return configManager.getCurrentBank() + 1;
+}
+
+static void setBank(uint8_t, uint8_t, int value) {
+    configManager.setCurrentBank(value - 1);
+}
+
+static int getBLE(uint8_t, uint8_t) {
+    return bleEnabled;
+}
+
+static void setBLE(uint8_t, uint8_t, int value) {
+    // BLEDevice::deinit() is hard to recover from, maybe just stop advertising?
+    bleEnabled = value;
+}
+
+static int getBrightness(uint8_t, uint8_t) {
+    return globalBrightness;
+}
+
+static void setBrightness(uint8_t, uint8_t, int value) {
+    globalBrightness = value; // Placeholder
+}
+
+static void exitMenu(MenuManager* mgr) {
+    mgr->close();
+}
+
+// ---------------------------------------------------------------------------
+// Árbol del menú (tablas en flash)
+// ---------------------------------------------------------------------------
+
+static constexpr MenuItem valueItem(const char* label, MenuGetter get, MenuSetter set,
+                                    int16_t minValue, int16_t maxValue, uint8_t arg = 0,
+                                    const char* const* names = nullptr, int16_t step = 1) {
+    return {label, MENU_ITEM_VALUE, arg, minValue, maxValue, step, get, set, names, nullptr, nullptr};
+}
+
+static constexpr MenuItem toggleItem(const char* label, MenuGetter get, MenuSetter set, uint8_t arg = 0) {
+    return {label, MENU_ITEM_TOGGLE, arg, 0, 1, 1, get, set, nullptr, nullptr, nullptr};
+}
+
+static constexpr MenuItem actionItem(const char* label, MenuCallback action) {
+    return {label, MENU_ITEM_ACTION, 0, 0, 0, 0, nullptr, nullptr, nullptr, action, nullptr};
+}
+
+static constexpr MenuItem submenuItem(const char* label, const MenuPage* submenu, uint8_t arg = 0) {
+    return {label, MENU_ITEM_SUBMENU, arg, 0, 0, 0, nullptr, nullptr, nullptr, nullptr, submenu};
+}
+
+template <size_t N>
+static constexpr MenuPage page(const MenuItem (&items)[N]) {
+    return {items, (uint8_t)N};
+}
+
+static constexpr const char* BUTTON_TYPE_NAMES[] = {"Momentary", "Toggle"};
+static constexpr const char* MIDI_TYPE_NAMES[] = {"Note", "CC", "PC"};
+
+// Un botón; el contexto (qué botón) lo pone el ítem que abre la página
+static constexpr MenuItem BUTTON_ITEMS[] = {
+    valueItem("Mode", getButtonField, setButtonField, BUTTON_MOMENTARY, BUTTON_TOGGLE, FIELD_TYPE, BUTTON_TYPE_NAMES),
+    valueItem("Message", getButtonField, setButtonField, MIDI_TYPE_NOTE, MIDI_TYPE_PC, FIELD_MIDI_TYPE, MIDI_TYPE_NAMES),
+    valueItem("Value", getButtonField, setButtonField, 0, 127, FIELD_VALUE),
+    valueItem("Channel", getButtonField, setButtonField, 1, 16, FIELD_CHANNEL),
+    valueItem("Velocity", getButtonField, setButtonField, 1, 127, FIELD_VELOCITY),
+    toggleItem("Enabled", getButtonField, setButtonField, FIELD_ENABLED)
+};
+static constexpr MenuPage BUTTON_PAGE = page(BUTTON_ITEMS);
+
+static constexpr MenuItem BUTTONS_ITEMS[] = {
+    submenuItem("Button 1", &BUTTON_PAGE, 0),
+    submenuItem("Button 2", &BUTTON_PAGE, 1),
+    submenuItem("Button 3", &BUTTON_PAGE, 2),
+    submenuItem("Button 4", &BUTTON_PAGE, 3)
+};
+static constexpr MenuPage BUTTONS_PAGE = page(BUTTONS_ITEMS);
+
+static constexpr MenuItem ROOT_ITEMS[] = {
+    valueItem("Bank", getBank, setBank, 1, NUM_BANKS),
+    submenuItem("Buttons", &BUTTONS_PAGE),
+    toggleItem("BLE", getBLE, setBLE),
+    valueItem("Brightness", getBrightness, setBrightness, 0, 255, 0, nullptr, 15),
+    actionItem("Exit", exitMenu)
+};
+static constexpr MenuPage ROOT_PAGE = page(ROOT_ITEMS);
+
+// ---------------------------------------------------------------------------
+// MenuManager
+// ---------------------------------------------------------------------------
+
 MenuManager::MenuManager() {
+    levels[0] = {&ROOT_PAGE, 0, 0};
 }
 
 void MenuManager::begin() {
-    buildMenu();
-}
-
-void MenuManager::buildMenu() {
-    items.clear();
-    
-    // 1. Bank Select
-    items.push_back({
-        "Bank", 
-        MENU_ITEM_VALUE, 
-        nullptr, // We'll handle value manually in callback or getter
-        0, 3, 
-        [](MenuManager* mgr) { 
-            configManager.nextBank(); 
-        }
-    });
-    
-    // 2. BLE Toggle
-    items.push_back({
-        "BLE", 
-        MENU_ITEM_TOGGLE, 
-        &bleEnabled, 
-        0, 1, 
-        [](MenuManager* mgr) {
-            // Toggle logic here if needed beyond just changing the int
-            // BLEDevice::deinit() is hard to recover from, maybe just stop advertising?
-        }
-    });
-    
-    // 3. Brightness (Placeholder)
-    items.push_back({
-        "Brightness",
-        MENU_ITEM_VALUE,
-        &globalBrightness,
-        0, 255,
-        nullptr
-    });
-    
-    // 4. Save & Exit
-    items.push_back({
-        "Exit", 
-        MENU_ITEM_ACTION, 
-        nullptr, 
-        0, 0, 
-        [](MenuManager* mgr) { mgr->close(); }
-    });
+    // El árbol es estático: sólo se vuelve a la raíz
+    depth = 0;
+    levels[0] = {&ROOT_PAGE, 0, 0};
 }
 
 bool MenuManager::isActive() {
     return active;
 }
 
-void MenuManager::open() {
+void MenuManager::open(int8_t heldButton) {
     active = true;
-    selectedIndex = 0;
+    editing = false;
+    this->heldButton = heldButton;
+    depth = 0;
+    levels[0].selected = 0;
     pedalboardUI.drawMenu(); // Initial draw
 }
 
 void MenuManager::close() {
     active = false;
-    
-    // Restore main UI background (Header, etc.)
+    editing = false;
+
+    // Restore main UI background (Header, etc.); se pinta en el próximo update()
     pedalboardUI.redraw();
-    
+
     // Force redraw of main interface
-    pedalboardUI.updateBankLabel("Bank " + String(configManager.getCurrentBank() + 1));
+    pedalboardUI.updateBankLabel(PedalboardUI::bankName(configManager.getCurrentBank()).c_str());
     for (int i = 0; i < 4; i++) {
         MidiButtonConfig cfg = configManager.getButtonConfig(i);
         pedalboardUI.setButtonState(i, false, cfg.type);
@@ -87,95 +182,151 @@ void MenuManager::close() {
 
 void MenuManager::handleButton(uint8_t logicalId, uint8_t eventType) {
     if (!active) return;
-    
-    // Simple navigation: Press to move/select
-    if (eventType == 1) { // PRESSED (using raw value 1 from ButtonManager.h or we should include it)
-        // We need to know the event types. Assuming 1 is Pressed.
-        // Let's check ButtonManager.h or assume standard
-        
-        switch (logicalId) {
-            case 0: // Button 1: Up
-                moveUp();
-                break;
-            case 1: // Button 2: Down
-                moveDown();
-                break;
-            case 2: // Button 3: Select / Toggle
-                select();
-                break;
-            case 3: // Button 4: Back
-                back();
-                break;
-        }
-        if (active) {
-            pedalboardUI.drawMenu(); // Redraw after action
-        }
+
+    // La pulsación larga que abrió el menú sigue generando repeticiones
+    // hasta que se suelta: no deben mover la selección
+    if (logicalId == heldButton) {
+        if (eventType == ButtonManager::EVENT_RELEASED) heldButton = -1;
+        return;
+    }
+
+    // Se actúa al pulsar; arriba/abajo también repiten al mantenerlos (valores largos)
+    bool repeat = eventType == ButtonManager::EVENT_REPEAT_PRESSED && logicalId <= 1;
+    if (eventType != ButtonManager::EVENT_PRESSED && !repeat) return;
+
+    switch (logicalId) {
+        case 0: // Button 1: Up
+            moveUp();
+            break;
+        case 1: // Button 2: Down
+            moveDown();
+            break;
+        case 2: // Button 3: Select / Toggle
+            select();
+            break;
+        case 3: // Button 4: Back
+            back();
+            break;
+    }
+    if (active) {
+        pedalboardUI.drawMenu(); // Redraw after action
     }
 }
 
+void MenuManager::stepValue(int direction) {
+    const MenuItem& item = selectedItem();
+    editValue += direction * item.step;
+    // Circular, como la lista
+    if (editValue > item.maxValue) editValue = item.minValue;
+    if (editValue < item.minValue) editValue = item.maxValue;
+}
+
 void MenuManager::moveUp() {
-    if (selectedIndex > 0) {
-        selectedIndex--;
+    if (editing) {
+        stepValue(1);
+        return;
+    }
+    MenuLevel& lv = level();
+    if (lv.selected > 0) {
+        lv.selected--;
     } else {
-        selectedIndex = items.size() - 1; // Wrap around
+        lv.selected = lv.page->count - 1; // Wrap around
     }
 }
 
 void MenuManager::moveDown() {
-    if (selectedIndex < items.size() - 1) {
-        selectedIndex++;
+    if (editing) {
+        stepValue(-1);
+        return;
+    }
+    MenuLevel& lv = level();
+    if (lv.selected < lv.page->count - 1) {
+        lv.selected++;
     } else {
-        selectedIndex = 0; // Wrap around
+        lv.selected = 0; // Wrap around
     }
 }
 
 void MenuManager::select() {
-    MenuItem& item = items[selectedIndex];
-    
-    if (item.callback) {
-        item.callback(this);
-    }
-    
-    if (item.type == MENU_ITEM_TOGGLE && item.valuePtr) {
-        *item.valuePtr = !(*item.valuePtr);
+    const MenuItem& item = selectedItem();
+    uint8_t context = level().context;
+
+    switch (item.type) {
+        case MENU_ITEM_ACTION:
+            if (item.action) item.action(this);
+            break;
+        case MENU_ITEM_TOGGLE:
+            if (item.get && item.set) item.set(context, item.arg, !item.get(context, item.arg));
+            break;
+        case MENU_ITEM_VALUE:
+            if (!item.get || !item.set) break;
+            if (editing) {
+                // Confirmar
+                item.set(context, item.arg, editValue);
+                editing = false;
+            } else {
+                editValue = constrain(item.get(context, item.arg), item.minValue, item.maxValue);
+                editing = true;
+            }
+            break;
+        case MENU_ITEM_SUBMENU:
+            if (item.submenu && depth < MENU_MAX_DEPTH - 1) {
+                depth++;
+                levels[depth] = {item.submenu, 0, item.arg};
+            }
+            break;
     }
 }
 
 void MenuManager::back() {
-    close();
+    if (editing) {
+        editing = false; // Descartar la edición
+    } else if (depth > 0) {
+        depth--;
+    } else {
+        close();
+    }
 }
 
-String MenuManager::getTitle() {
-    return "Menu";
+const char* MenuManager::getTitle() {
+    if (depth == 0) return "Menu";
+    // El título de un submenú es la etiqueta del ítem que lo abrió
+    const MenuLevel& parent = levels[depth - 1];
+    return parent.page->items[parent.selected].label;
 }
 
 int MenuManager::getItemCount() {
-    return items.size();
+    return level().page->count;
 }
 
-String MenuManager::getItemLabel(int index) {
-    if (index >= 0 && index < items.size()) {
-        return items[index].label;
+const char* MenuManager::getItemLabel(int index) {
+    if (index >= 0 && index < getItemCount()) {
+        return level().page->items[index].label;
     }
     return "";
 }
 
-String MenuManager::getItemValueStr(int index) {
-    if (index >= 0 && index < items.size()) {
-        MenuItem& item = items[index];
-        if (item.label == "Bank") {
-            return String(configManager.getCurrentBank() + 1);
-        }
-        if (item.type == MENU_ITEM_TOGGLE && item.valuePtr) {
-            return (*item.valuePtr) ? "ON" : "OFF";
-        }
-        if (item.type == MENU_ITEM_VALUE && item.valuePtr) {
-            return String(*item.valuePtr);
-        }
+MenuValueText MenuManager::getItemValueStr(int index) {
+    MenuValueText value;
+    if (index < 0 || index >= getItemCount()) return value;
+
+    const MenuItem& item = level().page->items[index];
+    if (!item.get) return value;
+
+    bool edited = editing && index == level().selected;
+    int v = edited ? editValue : item.get(level().context, item.arg);
+    if (edited) value.append('[');
+    if (item.type == MENU_ITEM_TOGGLE) {
+        value.append(v ? "ON" : "OFF");
+    } else if (item.valueNames && v >= item.minValue && v <= item.maxValue) {
+        value.append(item.valueNames[v - item.minValue]);
+    } else {
+        value.append(v);
     }
-    return "";
+    if (edited) value.append(']');
+    return value;
 }
 
 int MenuManager::getSelectedIndex() {
-    return selectedIndex;
+    return level().selected;
 }
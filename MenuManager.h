@@ -2,10 +2,11 @@
 #define MENU_MANAGER_H
 
 #include <Arduino.h>
-#include <vector>
+#include "StackString.h"
 
 // Forward declaration
 class MenuManager;
+struct MenuPage;
 
 // Menu Item Types
 enum MenuItemType {
@@ -15,54 +16,102 @@ enum MenuItemType {
     MENU_ITEM_SUBMENU
 };
 
+/** Submenús anidados como máximo (contando el raíz). */
+#define MENU_MAX_DEPTH 4
+
 // Callback function type
 typedef void (*MenuCallback)(MenuManager* mgr);
+/**
+ * Acceso al valor de un ítem. `context` es el `arg` del ítem de submenú que
+ * abrió la página (p. ej. el botón que se edita); `arg` es el del propio ítem.
+ */
+typedef int (*MenuGetter)(uint8_t context, uint8_t arg);
+typedef void (*MenuSetter)(uint8_t context, uint8_t arg, int value);
+
+/** Valor de un ítem ya formateado ("ON", "3", "[Toggle]"). */
+typedef StackString<12> MenuValueText;
 
+/**
+ * Ítem del menú. Los menús son tablas constexpr en flash: nada se construye
+ * ni se reserva en tiempo de ejecución.
+ */
 struct MenuItem {
-    String label;
+    const char* label;         // Literal; también es el título del submenú que abre
     MenuItemType type;
-    int* valuePtr;      // Pointer to value to modify (optional)
-    int minValue;
-    int maxValue;
-    MenuCallback callback; // Action to run when selected
+    uint8_t arg;               // Para get/set; en un submenú, contexto de sus ítems
+    int16_t minValue;          // VALUE: rango y paso de edición
+    int16_t maxValue;
+    int16_t step;
+    MenuGetter get;            // VALUE / TOGGLE
+    MenuSetter set;
+    const char* const* valueNames; // Opcional: nombre de cada valor desde minValue
+    MenuCallback action;       // ACTION
+    const MenuPage* submenu;   // SUBMENU
 };
 
+/** Página del menú: una tabla de ítems. */
+struct MenuPage {
+    const MenuItem* items;
+    uint8_t count;
+};
+
+/**
+ * @class MenuManager
+ * @brief Navegación del menú con los cuatro pulsadores.
+ *
+ * 1: arriba, 2: abajo, 3: seleccionar, 4: atrás. Seleccionar un valor lo pone
+ * en edición (se muestra entre corchetes): arriba/abajo lo cambian (al
+ * mantener pulsado se repite), seleccionar lo guarda y atrás lo descarta.
+ */
 class MenuManager {
 public:
     MenuManager();
-    
+
     void begin();
-    
+
     // State
     bool isActive();
-    void open();
+    /**
+     * @brief Abre el menú en la raíz.
+     * @param heldButton Botón que lo abrió y sigue pulsado (-1: ninguno); sus
+     *        eventos se ignoran hasta que se suelte.
+     */
+    void open(int8_t heldButton = -1);
     void close();
-    
+
     // Navigation
     void handleButton(uint8_t logicalId, uint8_t eventType);
     void moveUp();
     void moveDown();
     void select();
     void back();
-    
+
     // Drawing helpers
-    String getTitle();
+    const char* getTitle();
     int getItemCount();
-    String getItemLabel(int index);
-    String getItemValueStr(int index);
+    const char* getItemLabel(int index);
+    MenuValueText getItemValueStr(int index);
     int getSelectedIndex();
-    
-    // Actions
-    static void toggleBLE(MenuManager* mgr);
-    static void nextBank(MenuManager* mgr);
-    static void resetConfig(MenuManager* mgr);
+    bool isEditing() { return editing; }
 
 private:
+    // Página abierta en cada nivel, con su selección y su contexto
+    struct MenuLevel {
+        const MenuPage* page;
+        uint8_t selected;
+        uint8_t context;
+    };
+
     bool active = false;
-    int selectedIndex = 0;
-    std::vector<MenuItem> items;
-    
-    void buildMenu();
+    bool editing = false;
+    int8_t heldButton = -1;   // Ignorado hasta su EVENT_RELEASED
+    int editValue = 0;
+    uint8_t depth = 0;
+    MenuLevel levels[MENU_MAX_DEPTH];
+
+    MenuLevel& level() { return levels[depth]; }
+    const MenuItem& selectedItem() { return level().page->items[level().selected]; }
+    void stepValue(int direction);
 };
 
 extern MenuManager menuManager;
@@ -21,19 +21,25 @@ void MidiPedalboard::begin() {
     // delay(500); // Wait for serial - removed to speed up boot or moved if needed
     Serial.println("Starting MIDI Pedalboard...");
     
-    display.begin(50);
-    display.enableTextAA(false);
+    // Start the panel reset now; its settle time overlaps NVS/BLE init
+    display.beginAsync();
     
     // *** CRITICAL: Load configuration first ***
     configManager.begin();
     Serial.println("Config loaded");
     
+    display.begin(50);
+    display.enableTextAA(true);
+    display.enableGlyphCache(32 * 1024);
+    // Los redibujados por cuadros sólo envían las zonas que cambian
+    display.enableFrameDiff(true);
+    
     // Version definition
     const char* FIRMWARE_VERSION = "v1.3";
 
     // Inicialización de la UI
     pedalboardUI.begin(FIRMWARE_VERSION);
-    pedalboardUI.updateBankLabel("Bank " + String(configManager.getCurrentBank() + 1));
+    pedalboardUI.updateBankLabel(PedalboardUI::bankName(configManager.getCurrentBank()).c_str());
     
     // Inicialización del Menú
     menuManager.begin();
@@ -45,6 +51,11 @@ void MidiPedalboard::begin() {
         pedalboardUI.setButtonState(i, false, cfg.type); // Draw with correct type
     }
     
+    // A partir de aquí la pantalla se pinta en el otro núcleo, fuera del camino MIDI
+    if (!pedalboardUI.startRenderTask()) {
+        Serial.println("UI render task failed, drawing from loop");
+    }
+    
     // Inicialización de la interfaz MIDI
     midi.begin();
     
@@ -62,6 +73,9 @@ void MidiPedalboard::update() {
     configManager.update(); 
 
     midi.update();
+
+    // Sin tarea de pantalla los cambios se pintan aquí
+    if (!pedalboardUI.hasRenderTask()) pedalboardUI.update();
 }
 
 void MidiPedalboard::handleButtonEvent(uint8_t id, uint8_t eventType) {
@@ -84,37 +98,46 @@ void MidiPedalboard::handleButtonEvent(uint8_t id, uint8_t eventType) {
     // Bank Switching Logic
     // Button 1 (Index 0) Long Press: Previous Bank
     if (logicalId == 0 && eventType == ButtonManager::EVENT_LONG_PRESSED) {
-        // Turn off any active toggles from previous bank before switching?
-        // For now, just switch.
+        // Turn off any active toggles from previous bank before switching
+        releaseAllNotes();
         configManager.prevBank();
         
         // Visual Feedback
-        String bankName = "Bank " + String(configManager.getCurrentBank() + 1);
-        pedalboardUI.updateBankLabel(bankName);
-        pedalboardUI.showStatusMessage(bankName, MAGENTA);
+        UIText bankName = PedalboardUI::bankName(configManager.getCurrentBank());
+        pedalboardUI.updateBankLabel(bankName.c_str());
+        pedalboardUI.showStatusMessage(bankName.c_str(), MAGENTA);
         
         // Redraw buttons
         for (int i = 0; i < 4; i++) {
             MidiButtonConfig cfg = configManager.getButtonConfig(i);
-            toggleStates[i] = false; 
             pedalboardUI.setButtonState(i, false, cfg.type);
         }
         return;
     }
 
+    // Button 2 (Index 1) Long Press: Open Menu
+    // En el menú se cambian bancos y configuraciones: se apaga antes todo lo que
+    // suena, o no habría con qué nota apagarlo. El menú ignora este botón
+    // hasta que se suelte
+    if (logicalId == 1 && eventType == ButtonManager::EVENT_LONG_PRESSED) {
+        releaseAllNotes();
+        menuManager.open(logicalId);
+        return;
+    }
+
     // Button 4 (Index 3) Long Press: Next Bank
     if (logicalId == 3 && eventType == ButtonManager::EVENT_LONG_PRESSED) {
+        releaseAllNotes();
         configManager.nextBank();
         
         // Visual Feedback
-        String bankName = "Bank " + String(configManager.getCurrentBank() + 1);
-        pedalboardUI.updateBankLabel(bankName);
-        pedalboardUI.showStatusMessage(bankName, MAGENTA);
+        UIText bankName = PedalboardUI::bankName(configManager.getCurrentBank());
+        pedalboardUI.updateBankLabel(bankName.c_str());
+        pedalboardUI.showStatusMessage(bankName.c_str(), MAGENTA);
         
         // Redraw buttons
         for (int i = 0; i < 4; i++) {
             MidiButtonConfig cfg = configManager.getButtonConfig(i);
-            toggleStates[i] = false; 
             pedalboardUI.setButtonState(i, false, cfg.type);
         }
         return; 
@@ -136,28 +159,32 @@ void MidiPedalboard::handleButtonEvent(uint8_t id, uint8_t eventType) {
                     if (toggleStates[logicalId]) {
                         // Encender
                         midi.sendNoteOn(noteToSend, config.velocity);
-                        String msg = "Note ON " + String(config.value);
-                        pedalboardUI.showStatusMessage(msg, GREEN);
+                        UIText msg("Note ON ");
+                        msg.append(config.value);
+                        pedalboardUI.showStatusMessage(msg.c_str(), GREEN);
                     } else {
                         // Apagar
                         midi.sendNoteOff(noteToSend, config.velocity);
-                        String msg = "Note OFF " + String(config.value);
-                        pedalboardUI.showStatusMessage(msg, RED);
+                        UIText msg("Note OFF ");
+                        msg.append(config.value);
+                        pedalboardUI.showStatusMessage(msg.c_str(), RED);
                     }
                 }
                 else if (config.midiType == MIDI_TYPE_CC) {
                     MIDIAddress ccToSend = {config.value, (Channel)(config.channel)};
                     uint8_t ccValue = toggleStates[logicalId] ? 127 : 0;
                     midi.sendControlChange(ccToSend, ccValue);
-                    String msg = "CC " + String(config.value) + ": " + String(ccValue);
-                    pedalboardUI.showStatusMessage(msg);
+                    UIText msg("CC ");
+                    msg.append(config.value).append(": ").append(ccValue);
+                    pedalboardUI.showStatusMessage(msg.c_str());
                 }
                 else if (config.midiType == MIDI_TYPE_PC) {
                     // PC no tiene mucho sentido en toggle, pero lo enviaremos solo al encender
                     if (toggleStates[logicalId]) {
                         midi.sendProgramChange((Channel)(config.channel), config.value);
-                        String msg = "PC " + String(config.value);
-                        pedalboardUI.showStatusMessage(msg);
+                        UIText msg("PC ");
+                        msg.append(config.value);
+                        pedalboardUI.showStatusMessage(msg.c_str());
                     }
                 }
             }
@@ -181,23 +208,26 @@ void MidiPedalboard::handleButtonEvent(uint8_t id, uint8_t eventType) {
                     MIDIAddress noteToSend = {config.value, (Channel)(config.channel)};
                     midi.sendNoteOn(noteToSend, config.velocity);
                     
-                    String msg = "Note " + String(config.value);
-                    pedalboardUI.showStatusMessage(msg);
+                    UIText msg("Note ");
+                    msg.append(config.value);
+                    pedalboardUI.showStatusMessage(msg.c_str());
                 } 
                 else if (config.midiType == MIDI_TYPE_CC) {
                     // Control Change
                     MIDIAddress ccToSend = {config.value, (Channel)(config.channel)};
                     midi.sendControlChange(ccToSend, 127); // Send max value
                     
-                    String msg = "CC " + String(config.value);
-                    pedalboardUI.showStatusMessage(msg);
+                    UIText msg("CC ");
+                    msg.append(config.value);
+                    pedalboardUI.showStatusMessage(msg.c_str());
                 }
                 else if (config.midiType == MIDI_TYPE_PC) {
                     // Program Change
                     midi.sendProgramChange((Channel)(config.channel), config.value);
                     
-                    String msg = "PC " + String(config.value);
-                    pedalboardUI.showStatusMessage(msg);
+                    UIText msg("PC ");
+                    msg.append(config.value);
+                    pedalboardUI.showStatusMessage(msg.c_str());
                 }
             }
         } 
@@ -205,24 +235,49 @@ void MidiPedalboard::handleButtonEvent(uint8_t id, uint8_t eventType) {
             // Visual OFF
             pedalboardUI.setButtonState(logicalId, false, config.type);
             
-            // Check if we have an active note for this button
-            if (activeNotes[logicalId].active) {
-                uint8_t val = activeNotes[logicalId].value;
-                uint8_t ch = activeNotes[logicalId].channel;
-                uint8_t type = activeNotes[logicalId].midiType;
-                
-                if (type == MIDI_TYPE_NOTE) {
-                    MIDIAddress noteToSend = {val, (Channel)(ch)};
-                    // Use standard velocity for Note Off or stored? 
-                    // Standard practice is 0 or same velocity. Let's use 0x40 or 0.
-                    // Actually, Note Off velocity is often ignored or used for release velocity.
-                    // Let's use a default 64 for release to be safe, or we could track velocity too.
-                    // For simplicity, let's use 64 (0x40) for Note Off.
-                    midi.sendNoteOff(noteToSend, 0x40);
+            releaseActiveNote(logicalId);
+        }
+    }
+}
+
+void MidiPedalboard::releaseActiveNote(uint8_t logicalId) {
+    // Check if we have an active note for this button
+    if (!activeNotes[logicalId].active) return;
+    
+    uint8_t val = activeNotes[logicalId].value;
+    uint8_t ch = activeNotes[logicalId].channel;
+    uint8_t type = activeNotes[logicalId].midiType;
+    
+    if (type == MIDI_TYPE_NOTE) {
+        MIDIAddress noteToSend = {val, (Channel)(ch)};
+        // Use standard velocity for Note Off or stored? 
+        // Standard practice is 0 or same velocity. Let's use 0x40 or 0.
+        // Actually, Note Off velocity is often ignored or used for release velocity.
+        // Let's use a default 64 for release to be safe, or we could track velocity too.
+        // For simplicity, let's use 64 (0x40) for Note Off.
+        midi.sendNoteOff(noteToSend, 0x40);
+    }
+    
+    activeNotes[logicalId].active = false;
+}
+
+void MidiPedalboard::releaseAllNotes() {
+    for (uint8_t i = 0; i < 4; i++) {
+        releaseActiveNote(i);
+        
+        // Toggle en ON: deshacer lo que envió al encenderse (con la config actual,
+        // así que antes de cambiar de banco o de configuración)
+        if (toggleStates[i]) {
+            MidiButtonConfig config = configManager.getButtonConfig(i);
+            if (config.enabled) {
+                MIDIAddress address = {config.value, (Channel)(config.channel)};
+                if (config.midiType == MIDI_TYPE_NOTE) {
+                    midi.sendNoteOff(address, config.velocity);
+                } else if (config.midiType == MIDI_TYPE_CC) {
+                    midi.sendControlChange(address, 0);
                 }
-                
-                activeNotes[logicalId].active = false;
             }
+            toggleStates[i] = false;
         }
     }
 }
@@ -18,6 +18,8 @@ public:
 
 private:
     void handleButtonEvent(uint8_t id, uint8_t eventType);
+    void releaseActiveNote(uint8_t logicalId); // Note Off pendiente de un botón momentáneo
+    void releaseAllNotes(); // Apaga momentáneos y toggles en ON (el llamador repinta los pads)
 
     // MIDI Interface
     USBMIDI_Interface midi;
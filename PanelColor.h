@@ -0,0 +1,70 @@
+/**
+ * @file PanelColor.h
+ * @brief Color RGB565 en el orden de bytes que espera el panel.
+ *
+ * El ST7789 recibe cada píxel con el byte alto primero, mientras que el ESP32
+ * guarda los uint16_t en little-endian. PanelColor contiene la palabra ya
+ * intercambiada: copiada tal cual a un buffer DMA sale por SPI en el orden
+ * correcto. Los colores se construyen con color565() en tiempo de compilación,
+ * así que rellenos, texto y framebuffer no tocan cada píxel.
+ */
+#pragma once
+#include <Arduino.h>
+
+/** Intercambia los dos bytes de un RGB565 (nativo <-> orden del panel). */
+static constexpr uint16_t rgb565ByteSwap(uint16_t c) {
+  return (uint16_t)((c << 8) | (c >> 8));
+}
+
+/**
+ * Color listo para el panel. No se convierte implícitamente desde uint16_t:
+ * un RGB565 nativo debe pasar por PanelColor::fromRGB565() o color565().
+ */
+struct PanelColor {
+    uint16_t raw;   // Palabra tal como se escribe en los buffers de píxeles
+
+    /** Convierte un RGB565 nativo (0xF800 = rojo) al orden del panel. */
+    static constexpr PanelColor fromRGB565(uint16_t c) { return PanelColor{rgb565ByteSwap(c)}; }
+    /** Valor RGB565 nativo, para operar con los canales. */
+    constexpr uint16_t rgb565() const { return rgb565ByteSwap(raw); }
+
+    constexpr bool operator==(PanelColor o) const { return raw == o.raw; }
+    constexpr bool operator!=(PanelColor o) const { return raw != o.raw; }
+};
+
+/** Color del panel a partir de componentes de 8 bits (se truncan a 5/6/5). */
+static constexpr PanelColor color565(uint8_t r, uint8_t g, uint8_t b) {
+  return PanelColor::fromRGB565((uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)));
+}
+
+static_assert(sizeof(PanelColor) == sizeof(uint16_t), "PanelColor debe ocupar un píxel");
+static_assert(color565(255, 0, 0).raw == 0x00F8, "rojo: byte alto (0xF8) primero en memoria");
+
+/** Intercambia los bytes de dos píxeles empaquetados en una palabra de 32 bits. */
+static inline uint32_t rgb565ByteSwap2(uint32_t x) {
+  return ((x & 0x00FF00FFu) << 8) | ((x >> 8) & 0x00FF00FFu);
+}
+
+/**
+ * Pasa `count` píxeles RGB565 nativos al orden del panel (o al revés).
+ *
+ * Procesa dos píxeles por palabra de 32 bits cuando origen y destino quedan
+ * alineados; admite dst == src. Es para buffers que llegan de fuera (imágenes,
+ * LCD_addWindow): lo que dibuja la librería ya está en orden del panel.
+ */
+static inline void rgb565SwapPixels(uint16_t* dst, const uint16_t* src, uint32_t count) {
+  if (((uintptr_t)dst & 3) && count) {
+    *dst++ = rgb565ByteSwap(*src++);
+    count--;
+  }
+  if (((uintptr_t)src & 3) == 0) {
+    uint32_t* d = (uint32_t*)dst;
+    const uint32_t* s = (const uint32_t*)src;
+    uint32_t pairs = count / 2;
+    for (uint32_t i = 0; i < pairs; i++) d[i] = rgb565ByteSwap2(s[i]);
+    dst += pairs * 2;
+    src += pairs * 2;
+    count -= pairs * 2;
+  }
+  for (uint32_t i = 0; i < count; i++) dst[i] = rgb565ByteSwap(src[i]);
+}
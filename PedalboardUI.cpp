@@ -1,121 +1,235 @@
 #include "PedalboardUI.h"
 #include "MenuManager.h"
+#include "Font_Sans12.h"
 
 PedalboardUI pedalboardUI;
 
 PedalboardUI::PedalboardUI() {
+    const int W = SCREEN_WIDTH;
+    
+    header.place(0, 0, W, 31);
+    
+    bankLabel.place(0, 40, W, 21);
+    bankLabel.setStyle(5, BLACK, 2);
+    
+    // Diseño simple rectangular, fila centrada
+    const int BTN_WIDTH = 50;
+    const int BTN_HEIGHT = 50;
+    const int BTN_GAP = 10;
+    const int BTN_Y = 60;
+    int totalWidth = (4 * BTN_WIDTH) + (3 * BTN_GAP);
+    int startX = (W - totalWidth) / 2;
+    for (int i = 0; i < 4; i++) {
+        int x = startX + i * (BTN_WIDTH + BTN_GAP);
+        pads[i].place(x, BTN_Y, BTN_WIDTH, BTN_HEIGHT);
+        // Número debajo, centrado bajo su botón
+        padNumbers[i].place(x, BTN_Y + BTN_HEIGHT + 10, BTN_WIDTH, 8);
+        padNumbers[i].setStyle(0, BLACK, 1);
+        UIText number;
+        number.append(i + 1);
+        padNumbers[i].setText(number.c_str(), WHITE);
+    }
+    
+    // Barra de estado: fuente proporcional suavizada, más legible sobre el escenario
+    statusBar.place(0, 140, W, 25);
+    statusBar.setStyle(6, DARKGRAY, 1, &FontSans12);
+    
+    // Menú: título y huecos de fila fijos; los ítems se asignan al pintar
+    menuTitle.place(0, 0, MENU_WIDTH, 36);
+    for (int r = 0; r < MENU_VISIBLE_ROWS; r++) {
+        menuRows[r].place(0, MENU_LIST_Y + r * MENU_ROW_HEIGHT, MENU_WIDTH, MENU_ROW_HEIGHT);
+    }
+    menuTop = 0;
+    
+    screenCleared = false;
+    menuVisible = false;
+    renderTask = nullptr;
+    padStates = 0;
+    menuRequested = false;
+    redrawRequests = 0;
+    redrawsSeen = 0;
 }
 
 void PedalboardUI::begin(const char* version) {
+    header.setVersion(version);
+    updateBankLabel(bankName(0).c_str());
     redraw();
-    
-    // Draw Version (Top Right)
-    display.drawText(180, 10, version, YELLOW, BLACK, 2);
+}
 
-    // Bank label inicial
-    updateBankLabel("Bank 1");
-    
-    // Dibujar los 4 botones en estado OFF inicial
-    for (int i = 0; i < 4; i++) {
-        drawToggleButton(i, false);
+bool PedalboardUI::startRenderTask() {
+    if (renderTask) return true;
+    BaseType_t ok = xTaskCreatePinnedToCore(renderTaskLoop, "ui", UI_RENDER_STACK, this,
+                                            UI_RENDER_PRIORITY, &renderTask, UI_RENDER_CORE);
+    if (ok != pdPASS) {
+        renderTask = nullptr;
+        return false;
     }
+    return true;
 }
 
-void PedalboardUI::redraw() {
-    display.clearScreen(BLACK);
-    
-    // Header simple
-    display.drawCenteredText(10, "MIDI CONTROLLER", CYAN, BLACK, 2);
-    display.drawHLine(0, 30, display.getWidth(), DARKGRAY);
+void PedalboardUI::renderTaskLoop(void* arg) {
+    PedalboardUI* ui = (PedalboardUI*)arg;
+    for (;;) {
+        // Despierta con cada cambio; los que lleguen mientras pinta se juntan
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        ui->update();
+    }
 }
 
-void PedalboardUI::update() {
-    // No hace nada - sin animaciones
+void PedalboardUI::wake() {
+    if (renderTask) xTaskNotifyGive(renderTask);
+}
+
+UIText PedalboardUI::bankName(uint8_t bank) {
+    UIText name("Bank ");
+    name.append(bank + 1);
+    return name;
+}
+
+void PedalboardUI::redraw() {
+    menuRequested.store(false, std::memory_order_relaxed);
+    redrawRequests.fetch_add(1, std::memory_order_release);
+    wake();
 }
 
 void PedalboardUI::setButtonState(uint8_t index, bool state, uint8_t buttonType) {
     if (index >= 4) return;
     
-    // Siempre usar drawToggleButton (simple ON/OFF)
-    drawToggleButton(index, state);
+    // Siempre un botón simple ON/OFF
+    if (state) {
+        padStates.fetch_or(1 << index, std::memory_order_release);
+    } else {
+        padStates.fetch_and(~(1 << index), std::memory_order_release);
+    }
+    wake();
 }
 
-void PedalboardUI::updateBankLabel(const String& bankName) {
-    // Borra area del banco y redibuja
-    display.fillRect(0, 40, display.getWidth(), 20, BLACK);
-    display.drawCenteredText(45, bankName, YELLOW, BLACK, 2);
+void PedalboardUI::updateBankLabel(const char* bankName) {
+    UIText& text = bankText.back();
+    text.clear();
+    text.append(bankName);
+    bankText.publish();
+    wake();
 }
 
-void PedalboardUI::showStatusMessage(const String& msg, uint16_t color) {
-    // Barra de estado simple en el fondo
-    int y = 150;
-    display.fillRect(0, y - 10, display.getWidth(), 25, DARKGRAY);
-    display.drawCenteredText(y, msg, color, DARKGRAY, 1);
+void PedalboardUI::showStatusMessage(const char* msg, PanelColor color) {
+    UIStatus& next = status.back();
+    next.text.clear();
+    next.text.append(msg);
+    next.color = color;
+    status.publish();
+    wake();
 }
 
-void PedalboardUI::drawToggleButton(uint8_t index, bool state) {
-    // Diseño simple rectangular
-    const int BTN_WIDTH = 50;
-    const int BTN_HEIGHT = 50;
-    const int BTN_GAP = 10;
-    const int BTN_Y = 60;
+void PedalboardUI::drawMenu() {
+    int count = menuManager.getItemCount();
+    int selected = menuManager.getSelectedIndex();
     
-    // Calcular posición centrada
-    int totalWidth = (4 * BTN_WIDTH) + (3 * BTN_GAP);
-    int startX = (display.getWidth() - totalWidth) / 2;
-    int x = startX + index * (BTN_WIDTH + BTN_GAP);
-    
-    // Colores directos
-    uint16_t fillColor = state ? GREEN : DARKGRAY;
-    uint16_t borderColor = state ? WHITE : GRAY;
-    uint16_t textColor = state ? BLACK : WHITE;
-    
-    // Dibujar rectángulo
-    display.fillRoundRect(x, BTN_Y, BTN_WIDTH, BTN_HEIGHT, 5, fillColor);
-    display.drawRoundRect(x, BTN_Y, BTN_WIDTH, BTN_HEIGHT, 5, borderColor);
-    
-    // Texto ON/OFF
-    String label = state ? "ON" : "OFF";
-    int textX = x + (BTN_WIDTH - display.getTextWidth(label, 2)) / 2;
-    int textY = BTN_Y + (BTN_HEIGHT - display.getCharHeight(2)) / 2;
-    display.drawText(textX, textY, label, textColor, fillColor, 2);
-    
-    // Número debajo
-    String numLabel = String(index + 1);
-    int numY = BTN_Y + BTN_HEIGHT + 10;
-    display.drawCenteredText(numY, numLabel, WHITE, BLACK, 1);
+    // Ventana visible: al entrar empieza arriba y luego se desplaza lo justo
+    // para que la selección quede dentro
+    if (!menuRequested.load(std::memory_order_relaxed)) menuTop = 0;
+    if (selected < menuTop) menuTop = selected;
+    if (selected >= menuTop + MENU_VISIBLE_ROWS) menuTop = selected - MENU_VISIBLE_ROWS + 1;
+    if (menuTop > count - MENU_VISIBLE_ROWS) menuTop = count - MENU_VISIBLE_ROWS;
+    if (menuTop < 0) menuTop = 0;
+    
+    // Sólo se formatean los ítems de la ventana
+    MenuSnapshot& view = menuView.back();
+    view.title = menuManager.getTitle();
+    view.selectedRow = -1;
+    for (int r = 0; r < MENU_VISIBLE_ROWS; r++) {
+        int i = menuTop + r;
+        if (i < count) {
+            view.labels[r] = menuManager.getItemLabel(i);
+            view.values[r] = menuManager.getItemValueStr(i);
+            if (i == selected) view.selectedRow = r;
+        } else {
+            view.labels[r] = nullptr;
+            view.values[r].clear();
+        }
+    }
+    menuView.publish();
+    menuRequested.store(true, std::memory_order_release);
+    wake();
 }
 
-void PedalboardUI::drawMenu() {
-    display.clearScreen(BLACK);
-    
-    // Title
-    display.drawText(10, 10, menuManager.getTitle(), CYAN, BLACK, 2);
-    
-    display.drawHLine(0, 35, 240, CYAN);
-    
-    // Items
-    int startY = 50;
-    int lineHeight = 30;
-    
-    for (int i = 0; i < menuManager.getItemCount(); i++) {
-        int y = startY + (i * lineHeight);
-        
-        uint16_t textColor = WHITE;
-        uint16_t bgColor = BLACK;
-        
-        if (i == menuManager.getSelectedIndex()) {
-            textColor = BLACK;
-            bgColor = WHITE;
-            display.fillRect(0, y - 5, 240, lineHeight, WHITE);
-        }
-        
-        display.drawText(10, y, menuManager.getItemLabel(i), textColor, bgColor, 2);
-        
-        // Value (right aligned-ish)
-        String val = menuManager.getItemValueStr(i);
-        if (val.length() > 0) {
-            display.drawText(160, y, val, textColor, bgColor, 2);
+void PedalboardUI::update() {
+    // Último estado de cada ranura; los intermedios no llegan a pintarse.
+    // redrawRequests antes que menuRequested: redraw() escribe en el otro orden.
+    uint32_t redraws = redrawRequests.load(std::memory_order_acquire);
+    bool menu = menuRequested.load(std::memory_order_acquire);
+    if (redraws != redrawsSeen || menu != menuVisible) {
+        // Cambio de pantalla: se borra una vez y se repinta entera
+        redrawsSeen = redraws;
+        menuVisible = menu;
+        screenCleared = false;
+    }
+    if (bankText.update()) bankLabel.setText(bankText.front().c_str(), YELLOW);
+    if (status.update()) statusBar.setText(status.front().text.c_str(), status.front().color);
+    uint8_t padBits = padStates.load(std::memory_order_acquire);
+    for (int i = 0; i < 4; i++) pads[i].setState(padBits & (1 << i));
+    
+    if (menuVisible) {
+        menuView.update();
+        renderMenu(menuView.front());
+        return;
+    }
+    
+    if (!screenCleared) {
+        header.invalidate();
+        bankLabel.invalidate();
+        statusBar.invalidate();
+        for (int i = 0; i < 4; i++) {
+            pads[i].invalidate();
+            padNumbers[i].invalidate();
         }
     }
+    
+    bool dirty = header.isDirty() || bankLabel.isDirty() || statusBar.isDirty();
+    for (int i = 0; i < 4; i++) {
+        dirty = dirty || pads[i].isDirty() || padNumbers[i].isDirty();
+    }
+    if (!dirty) return;
+    
+    // Todos los widgets sucios en un único cuadro
+    display.beginFrame();
+    if (!screenCleared) {
+        display.clearScreen(BLACK);
+        screenCleared = true;
+    }
+    header.render();
+    bankLabel.render();
+    for (int i = 0; i < 4; i++) {
+        pads[i].render();
+        padNumbers[i].render();
+    }
+    statusBar.render();
+    display.endFrame();
+}
+
+void PedalboardUI::renderMenu(const MenuSnapshot& view) {
+    // Las filas iguales a lo pintado no se ensucian
+    menuTitle.setTitle(view.title);
+    for (int r = 0; r < MENU_VISIBLE_ROWS; r++) {
+        menuRows[r].setItem(view.labels[r], view.values[r].c_str(), r == view.selectedRow);
+    }
+    
+    if (!screenCleared) {
+        menuTitle.invalidate();
+        for (int r = 0; r < MENU_VISIBLE_ROWS; r++) menuRows[r].invalidate();
+    }
+    
+    bool dirty = menuTitle.isDirty();
+    for (int r = 0; r < MENU_VISIBLE_ROWS; r++) dirty = dirty || menuRows[r].isDirty();
+    if (!dirty) return;
+    
+    // Mover la selección repinta dos filas; desplazar la ventana, sólo la lista
+    display.beginFrame();
+    if (!screenCleared) {
+        display.clearScreen(BLACK);
+        screenCleared = true;
+    }
+    menuTitle.render();
+    for (int r = 0; r < MENU_VISIBLE_ROWS; r++) menuRows[r].render();
+    display.endFrame();
 }
@@ -2,23 +2,106 @@
 #define PEDALBOARD_UI_H
 
 #include "ST7789_Graphics.h"
+#include "UIWidgets.h"
+#include "LatestValue.h"
+#include "MenuManager.h"
+#include <atomic>
 
+/** Caracteres (con el terminador) de los textos de etiqueta y barra de estado. */
+#define UI_TEXT_MAX LABEL_TEXT_MAX
+/** Núcleo de la tarea de pantalla: el contrario al del loop (MIDI). */
+#define UI_RENDER_CORE 0
+#define UI_RENDER_STACK 6144
+#define UI_RENDER_PRIORITY 1
+
+/** Geometría del menú: ancho del resaltado, primera fila y alto de fila. */
+#define MENU_WIDTH SCREEN_WIDTH
+#define MENU_LIST_Y 45
+#define MENU_ROW_HEIGHT 30
+/** Filas que caben en pantalla; con más ítems la lista se desplaza. */
+#define MENU_VISIBLE_ROWS ((SCREEN_HEIGHT - MENU_LIST_Y) / MENU_ROW_HEIGHT)
+
+/** Texto de etiqueta o barra de estado, formateado sin memoria dinámica. */
+typedef StackString<UI_TEXT_MAX> UIText;
+
+/** Contenido de la barra de estado. */
+struct UIStatus {
+    UIText text;
+    PanelColor color;
+};
+
+/**
+ * Lo que se ve del menú, armado en el loop: la tarea de pantalla no llama a
+ * MenuManager ni a ConfigManager, que el loop modifica.
+ */
+struct MenuSnapshot {
+    const char* title;
+    const char* labels[MENU_VISIBLE_ROWS];   // Literales; nullptr: fila vacía
+    MenuValueText values[MENU_VISIBLE_ROWS];
+    int8_t selectedRow;                      // -1: ninguna en la ventana
+};
+
+/**
+ * @class PedalboardUI
+ * @brief Pantalla principal y menú.
+ *
+ * Los métodos públicos sólo dejan el estado nuevo en una ranura por widget
+ * (unos microsegundos, sin SPI ni memoria dinámica) y despiertan a la tarea
+ * de startRenderTask(), que en el otro núcleo toma el último valor de cada
+ * ranura y pinta en un solo cuadro lo que cambió. Nada se descarta: si llegan
+ * varios cambios del mismo widget antes de pintar, cuenta el último.
+ * El menú usa filas retenidas y una ventana de MENU_VISIBLE_ROWS ítems:
+ * navegar repinta la fila que pierde la selección y la que la gana.
+ * Las ranuras son de un solo productor: llamar siempre desde la misma tarea
+ * (el loop). Sin tarea, update() hace ese trabajo en la tarea que lo llame.
+ */
 class PedalboardUI {
 public:
     PedalboardUI();
     
-    void begin(const char* version);
-    void redraw(); // Redraw static elements (Header, etc.)
-    void update(); // Vacío - sin animaciones
+    void begin(const char* version); // Antes de startRenderTask()
+    /** @brief Lanza la tarea de pantalla; desde aquí sólo ella toca el display. */
+    bool startRenderTask();
+    bool hasRenderTask() { return renderTask != nullptr; }
+    void update(); // Toma el último estado de cada ranura y pinta los widgets que cambiaron
+    
+    void redraw(); // Repintar toda la pantalla principal
     void setButtonState(uint8_t index, bool state, uint8_t buttonType = 0);
-    void updateBankLabel(const String& bankName);
-    void showStatusMessage(const String& msg, uint16_t color = GREEN);
+    void updateBankLabel(const char* bankName);
+    void showStatusMessage(const char* msg, PanelColor color = GREEN);
+    /** @brief "Bank N" con N desde 1, como lo muestran la etiqueta y la barra de estado. */
+    static UIText bankName(uint8_t bank);
     
     // Menu Drawing
+    /** @brief Muestra el menú con el estado actual de menuManager (lo copia al llamar). */
     void drawMenu();
 
 private:
-    void drawToggleButton(uint8_t index, bool state);
+    TaskHandle_t renderTask;
+    
+    // Ranuras que escribe el loop y lee la tarea de pantalla
+    std::atomic<uint8_t> padStates;        // Bit i: pad i en ON
+    LatestValue<UIText> bankText;
+    LatestValue<UIStatus> status;
+    LatestValue<MenuSnapshot> menuView;
+    std::atomic<bool> menuRequested;       // false: pantalla principal
+    std::atomic<uint32_t> redrawRequests;  // Cada redraw() la incrementa
+    
+    HeaderWidget header;
+    LabelWidget bankLabel;
+    PadWidget pads[4];
+    LabelWidget padNumbers[4];
+    LabelWidget statusBar;
+    MenuTitleWidget menuTitle;
+    MenuRowWidget menuRows[MENU_VISIBLE_ROWS];
+    int menuTop;          // Primer ítem visible del menú (lo mueve el loop)
+    bool screenCleared;   // false: borrar la pantalla antes de pintar los widgets
+    bool menuVisible;     // El menú tapa la pantalla principal
+    uint32_t redrawsSeen; // Último valor de redrawRequests atendido
+    
+    static void renderTaskLoop(void* arg);
+    void wake();
+    void renderMenu(const MenuSnapshot& view);
 };
 
 extern PedalboardUI pedalboardUI;
@@ -0,0 +1,81 @@
+/**
+ * @file RGB565Blend.h
+ * @brief Mezcla de colores RGB565 en aritmética entera (SWAR).
+ *
+ * El color se reparte en una palabra de 32 bits como 0b00000GGGGGG00000RRRRR000000BBBBB
+ * (máscara 0x07E0F81F): cada canal queda con al menos 5 bits libres encima, de
+ * modo que una sola multiplicación por alpha (0..32) mezcla los tres canales a
+ * la vez sin que se pisen.
+ *
+ * Los kernels trabajan en RGB565 nativo (rojo en los bits altos). Los colores y
+ * buffers en orden del panel (PanelColor.h) se convierten antes y después con
+ * rgb565() / rgb565SwapPixels().
+ */
+#pragma once
+#include <Arduino.h>
+
+/** Máscara de canales separados para la mezcla SWAR. */
+#define RGB565_SWAR_MASK 0x07E0F81Fu
+
+/** Separa los canales de un color RGB565 en una palabra de 32 bits. */
+static inline uint32_t rgb565Spread(uint16_t c) {
+  return (c | ((uint32_t)c << 16)) & RGB565_SWAR_MASK;
+}
+
+/** Recompone un color RGB565 desde su forma separada. */
+static inline uint16_t rgb565Pack(uint32_t x) {
+  x &= RGB565_SWAR_MASK;
+  return (uint16_t)(x | (x >> 16));
+}
+
+/**
+ * Mezcla fg sobre bg. alpha 0..255 (0 = bg, 255 = fg); se reduce a 5 bits,
+ * que es la precisión de los canales rojo y azul.
+ */
+static inline uint16_t rgb565Blend(uint16_t bg, uint16_t fg, uint8_t alpha) {
+  uint32_t a = (alpha + 4) >> 3;
+  uint32_t b = rgb565Spread(bg);
+  uint32_t f = rgb565Spread(fg);
+  return rgb565Pack(b + (((f - b) * a) >> 5));
+}
+
+/** dst[i] = mezcla de src[i] sobre dst[i] con alpha constante. */
+static inline void rgb565BlendSpan(uint16_t* dst, const uint16_t* src, uint32_t count, uint8_t alpha) {
+  uint32_t a = (alpha + 4) >> 3;
+  if (a == 0) return;
+  if (a == 32) {
+    memcpy(dst, src, count * sizeof(uint16_t));
+    return;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t b = rgb565Spread(dst[i]);
+    uint32_t f = rgb565Spread(src[i]);
+    dst[i] = rgb565Pack(b + (((f - b) * a) >> 5));
+  }
+}
+
+/** dst[i] = mezcla de un color fijo sobre dst[i] con alpha constante. */
+static inline void rgb565BlendSpanColor(uint16_t* dst, uint16_t color, uint32_t count, uint8_t alpha) {
+  uint32_t a = (alpha + 4) >> 3;
+  if (a == 0) return;
+  uint32_t f = rgb565Spread(color);
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t b = rgb565Spread(dst[i]);
+    dst[i] = rgb565Pack(b + (((f - b) * a) >> 5));
+  }
+}
+
+/** dst[i] = mezcla de un color fijo sobre dst[i] con alpha por píxel (mask[i]). */
+static inline void rgb565BlendSpanMask(uint16_t* dst, uint16_t color, const uint8_t* mask, uint32_t count) {
+  uint32_t f = rgb565Spread(color);
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t a = (mask[i] + 4) >> 3;
+    if (a == 0) continue;
+    if (a == 32) {
+      dst[i] = color;
+      continue;
+    }
+    uint32_t b = rgb565Spread(dst[i]);
+    dst[i] = rgb565Pack(b + (((f - b) * a) >> 5));
+  }
+}
@@ -1,5 +1,6 @@
 #include "ST7789_Graphics.h"
 #include <math.h>
+#include "esp_heap_caps.h"
 
 // Fuente bitmap 5x8 pixels - EXTENDIDA CON MINÚSCULAS
 const uint8_t ST7789_Graphics::font5x8[128][8] = {
@@ -144,15 +145,41 @@ ST7789_Graphics display;
 
 ST7789_Graphics::ST7789_Graphics() {
   initialized = false;
+  initStarted = false;
   textAAEnabled = false;
+  scrollStart = 0;
+  scrollLength = 0;
+  scrollTopLine = 0;
+  scrollLines = 0;
+  framebuffer = nullptr;
+  dirtyCount = 0;
+  indexedBuffer = nullptr;
+  resetPalette();
+  dlOps = nullptr;
+  dlArena = nullptr;
+  dlCount = 0;
+  dlArenaUsed = 0;
+  dlRecording = false;
+  frameDiff = false;
+  tilesStale = true;
+  frameSkipTiles = false;
+  currentFont = nullptr;
+  resetClip();
+}
+
+void ST7789_Graphics::beginAsync() {
+  LCD_InitStart();
+  initStarted = true;
 }
 
 bool ST7789_Graphics::begin(uint8_t brightness) {
   try {
-    LCD_Init();
-    setBrightness(brightness);
-    clearScreen();
+    if (!initStarted) beginAsync();
+    LCD_InitFinish();
     initialized = true;
+    // Primer cuadro limpio antes de encender la retroiluminación
+    clearScreen();
+    setBrightness(brightness);
     return true;
   } catch (...) {
     initialized = false;
@@ -169,84 +196,1075 @@ void ST7789_Graphics::setBrightness(uint8_t brightness) {
   Set_Backlight(brightness);
 }
 
-void ST7789_Graphics::clearScreen(uint16_t color) {
+void ST7789_Graphics::clearScreen(PanelColor color) {
   if (!initialized) return;
-
-  uint16_t colorBuffer[SCREEN_WIDTH];
-  for (int i = 0; i < SCREEN_WIDTH; i++) {
-    colorBuffer[i] = color;
-  }
-
-  // Limpiar línea por línea para asegurar borrado completo
-  for (int y = 0; y < SCREEN_HEIGHT; y++) {
-    LCD_addWindow(0, y, SCREEN_WIDTH - 1, y, colorBuffer);
-    if (y % 50 == 0) delayMicroseconds(100);  // Pausa cada 50 líneas
-  }
-
-  // Pausa adicional para asegurar que se complete
-  delay(10);
+  rasterFill(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, color);
 }
 
 void ST7789_Graphics::forceRefresh() {
   if (!initialized) return;
 
-  // Resetear el display completamente
-  LCD_Reset();
-  delay(50);
+  // Resetear y reinicializar el display completamente
+  LCD_Init();
 
   // Limpiar con negro
   clearScreen(BLACK);
 }
 
-void ST7789_Graphics::drawPixel(int x, int y, uint16_t color) {
+void ST7789_Graphics::drawPixel(int x, int y, PanelColor color) {
   if (!initialized) return;
-  if (x < 0 || x >= SCREEN_WIDTH || y < 0 || y >= SCREEN_HEIGHT) return;
-  LCD_addWindow(x, y, x, y, &color);
+  rasterFill(x, y, 1, 1, color);
 }
 
-void ST7789_Graphics::fillRect(int x, int y, int width, int height, uint16_t color) {
+void ST7789_Graphics::fillRect(int x, int y, int width, int height, PanelColor color) {
   if (!initialized) return;
-  if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
-  if (x + width > SCREEN_WIDTH) width = SCREEN_WIDTH - x;
-  if (y + height > SCREEN_HEIGHT) height = SCREEN_HEIGHT - y;
-  if (width <= 0 || height <= 0) return;
+  rasterFill(x, y, width, height, color);
+}
+
+// ---------------------------------------------------------------------------
+// Recorte y traslación
+// ---------------------------------------------------------------------------
+
+bool ST7789_Graphics::pushClip(int x, int y, int width, int height) {
+  if (clipDepth == CLIP_STACK_DEPTH) return false;
+  clipStack[clipDepth++] = clipState;
+
+  GfxRect& c = clipState.clip;
+  int x0 = max(x + clipState.originX, (int)c.x);
+  int y0 = max(y + clipState.originY, (int)c.y);
+  int x1 = min(x + clipState.originX + width, c.x + c.w);
+  int y1 = min(y + clipState.originY + height, c.y + c.h);
+  // Un recorte vacío sigue siendo válido: no deja dibujar nada
+  c = {(int16_t)x0, (int16_t)y0, (int16_t)max(x1 - x0, 0), (int16_t)max(y1 - y0, 0)};
+  return true;
+}
+
+bool ST7789_Graphics::pushViewport(int x, int y, int width, int height) {
+  if (!pushClip(x, y, width, height)) return false;
+  clipState.originX += x;
+  clipState.originY += y;
+  return true;
+}
+
+void ST7789_Graphics::popClip() {
+  if (clipDepth > 0) clipState = clipStack[--clipDepth];
+}
+
+void ST7789_Graphics::resetClip() {
+  clipDepth = 0;
+  clipState.clip = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+  clipState.originX = 0;
+  clipState.originY = 0;
+}
+
+GfxRect ST7789_Graphics::getClip() {
+  GfxRect c = clipState.clip;
+  c.x -= clipState.originX;
+  c.y -= clipState.originY;
+  return c;
+}
+
+/**
+ * Pasa un rectángulo de coordenadas locales a pantalla y lo recorta contra
+ * el recorte actual. Devuelve false si no queda nada que dibujar.
+ */
+bool ST7789_Graphics::clipToScreen(int& x, int& y, int& w, int& h) {
+  const GfxRect& c = clipState.clip;
+  x += clipState.originX;
+  y += clipState.originY;
+  if (x < c.x) { w -= c.x - x; x = c.x; }
+  if (y < c.y) { h -= c.y - y; y = c.y; }
+  if (x + w > c.x + c.w) w = c.x + c.w - x;
+  if (y + h > c.y + c.h) h = c.y + c.h - y;
+  return w > 0 && h > 0;
+}
+
+// ---------------------------------------------------------------------------
+// Framebuffer con rectángulos sucios
+// ---------------------------------------------------------------------------
+
+bool ST7789_Graphics::enableFramebuffer(bool enable) {
+  if (enable) enableIndexedFramebuffer(false);
+  if (!enable) {
+    if (framebuffer) {
+      flush();
+      LCD_WaitIdle();
+      heap_caps_free(framebuffer);
+      framebuffer = nullptr;
+    }
+    return true;
+  }
+  if (framebuffer) return true;
+
+  size_t bytes = (size_t)SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+  framebuffer = (uint16_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!framebuffer) {
+    framebuffer = (uint16_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  if (!framebuffer) return false;
+
+  memset(framebuffer, 0, bytes);
+  dirtyCount = 0;
+  return true;
+}
+
+void ST7789_Graphics::flush() {
+  if (!framebuffer && !indexedBuffer) return;
+  tilesStale = true;
+  for (int i = 0; i < dirtyCount; i++) {
+    const GfxRect& r = dirty[i];
+    if (indexedBuffer) {
+      flushIndexedRect(r);
+      continue;
+    }
+    LCD_BeginWindow(r.x, r.y, r.x + r.w - 1, r.y + r.h - 1);
+    for (int row = 0; row < r.h; row++) {
+      LCD_PushPixels(framebuffer + (r.y + row) * SCREEN_WIDTH + r.x, r.w);
+    }
+    LCD_EndWindow();
+  }
+  dirtyCount = 0;
+}
+
+// ---------------------------------------------------------------------------
+// Framebuffer indexado (4 bpp) y paleta
+// ---------------------------------------------------------------------------
+
+static const PanelColor DEFAULT_PALETTE[PALETTE_SIZE] = {
+  BLACK, WHITE, RED, GREEN, BLUE, YELLOW, CYAN, MAGENTA,
+  ORANGE, PINK, PURPLE, BROWN, GRAY, LIGHTGRAY, DARKGRAY, NAVY
+};
+
+bool ST7789_Graphics::enableIndexedFramebuffer(bool enable) {
+  if (enable) enableFramebuffer(false);
+  if (!enable) {
+    if (indexedBuffer) {
+      flush();
+      LCD_WaitIdle();
+      heap_caps_free(indexedBuffer);
+      indexedBuffer = nullptr;
+    }
+    return true;
+  }
+  if (indexedBuffer) return true;
+
+  // Ancho y alto del panel son pares: cada fila ocupa SCREEN_WIDTH / 2 bytes
+  size_t bytes = (size_t)SCREEN_WIDTH * SCREEN_HEIGHT / 2;
+  indexedBuffer = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!indexedBuffer) return false;
+
+  memset(indexedBuffer, 0, bytes);
+  dirtyCount = 0;
+  return true;
+}
+
+void ST7789_Graphics::setPaletteColor(uint8_t index, PanelColor color) {
+  palette[index & (PALETTE_SIZE - 1)] = color;
+  rebuildPaletteLut();
+  if (indexedBuffer) markDirty(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+}
+
+void ST7789_Graphics::setPalette(const PanelColor* colors, uint8_t count) {
+  if (count > PALETTE_SIZE) count = PALETTE_SIZE;
+  memcpy(palette, colors, count * sizeof(PanelColor));
+  rebuildPaletteLut();
+  if (indexedBuffer) markDirty(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+}
+
+void ST7789_Graphics::resetPalette() {
+  setPalette(DEFAULT_PALETTE, PALETTE_SIZE);
+}
+
+void ST7789_Graphics::rebuildPaletteLut() {
+  // Cada byte del framebuffer son dos píxeles: precalcular los 256 pares
+  // deja la expansión en una lectura y una escritura de 32 bits por byte.
+  for (int b = 0; b < 256; b++) {
+    uint16_t pair[2] = {palette[b & 0x0F].raw, palette[b >> 4].raw};
+    memcpy(&paletteLut[b], pair, sizeof(uint32_t));
+  }
+  lastColor = palette[0];
+  lastIndex = 0;
+}
+
+uint8_t ST7789_Graphics::paletteIndex(PanelColor color) {
+  if (color == lastColor) return lastIndex;
+
+  // Coincidencia exacta o, si no, la entrada más cercana en RGB
+  int best = 0;
+  int32_t bestDist = INT32_MAX;
+  uint16_t c = color.rgb565();
+  int r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+  for (int i = 0; i < PALETTE_SIZE; i++) {
+    if (palette[i] == color) {
+      best = i;
+      break;
+    }
+    uint16_t p = palette[i].rgb565();
+    int dr = (r - (p >> 11)) * 2;   // Escalar R y B a 6 bits como G
+    int dg = g - ((p >> 5) & 0x3F);
+    int db = (b - (p & 0x1F)) * 2;
+    int32_t dist = dr * dr + dg * dg + db * db;
+    if (dist < bestDist) {
+      bestDist = dist;
+      best = i;
+    }
+  }
+  lastColor = color;
+  lastIndex = best;
+  return best;
+}
+
+/** Expande `pairs` bytes de índices a RGB565 usando la tabla de pares. */
+static void expandIndexedRow(uint16_t* dst, const uint8_t* src, uint32_t pairs, const uint32_t* lut) {
+  if (((uintptr_t)dst & 3) == 0) {
+    uint32_t* out = (uint32_t*)dst;
+    for (uint32_t i = 0; i < pairs; i++) out[i] = lut[src[i]];
+  } else {
+    for (uint32_t i = 0; i < pairs; i++) {
+      memcpy(dst + 2 * i, &lut[src[i]], sizeof(uint32_t));
+    }
+  }
+}
+
+void ST7789_Graphics::flushIndexedRect(const GfxRect& r) {
+  // Alinear a pares de píxeles para expandir bytes completos
+  int x0 = r.x & ~1;
+  int x1 = (r.x + r.w + 1) & ~1;
+  LCD_BeginWindow(x0, r.y, x1 - 1, r.y + r.h - 1);
+  for (int row = 0; row < r.h; row++) {
+    const uint8_t* src = indexedBuffer + (r.y + row) * (SCREEN_WIDTH / 2) + x0 / 2;
+    uint32_t pairs = (x1 - x0) / 2;
+    while (pairs > 0) {
+      // Expandir directamente sobre el buffer DMA, sin copia intermedia
+      uint32_t avail;
+      uint16_t* dst = LCD_StreamReserve(&avail);
+      uint32_t n = avail / 2;
+      if (n > pairs) n = pairs;
+      expandIndexedRow(dst, src, n, paletteLut);
+      LCD_StreamCommit(n * 2);
+      src += n;
+      pairs -= n;
+    }
+  }
+  LCD_EndWindow();
+}
+
+// Área de la unión de dos rectángulos
+static int32_t unionArea(const GfxRect& a, const GfxRect& b) {
+  int x0 = min(a.x, b.x), y0 = min(a.y, b.y);
+  int x1 = max(a.x + a.w, b.x + b.w), y1 = max(a.y + a.h, b.y + b.h);
+  return (int32_t)(x1 - x0) * (y1 - y0);
+}
+
+static GfxRect unionRect(const GfxRect& a, const GfxRect& b) {
+  int x0 = min(a.x, b.x), y0 = min(a.y, b.y);
+  int x1 = max(a.x + a.w, b.x + b.w), y1 = max(a.y + a.h, b.y + b.h);
+  return {(int16_t)x0, (int16_t)y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+void ST7789_Graphics::markDirty(int x, int y, int w, int h) {
+  GfxRect r = {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+
+  // Fusionar mientras la unión no cueste más píxeles que enviar ambos por separado
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (int i = 0; i < dirtyCount; i++) {
+      int32_t separate = (int32_t)r.w * r.h + (int32_t)dirty[i].w * dirty[i].h;
+      if (unionArea(r, dirty[i]) <= separate) {
+        r = unionRect(r, dirty[i]);
+        dirty[i] = dirty[--dirtyCount];
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  if (dirtyCount == MAX_DIRTY_RECTS) {
+    // Lista llena: absorber el rectángulo cuya unión crece menos
+    int best = 0;
+    int32_t bestGrowth = INT32_MAX;
+    for (int i = 0; i < dirtyCount; i++) {
+      int32_t growth = unionArea(r, dirty[i]) - (int32_t)dirty[i].w * dirty[i].h;
+      if (growth < bestGrowth) {
+        bestGrowth = growth;
+        best = i;
+      }
+    }
+    r = unionRect(r, dirty[best]);
+    dirty[best] = dirty[--dirtyCount];
+  }
+  dirty[dirtyCount++] = r;
+}
+
+// ---------------------------------------------------------------------------
+// Figuras por tramos horizontales
+// ---------------------------------------------------------------------------
+
+/** Radio máximo de esquina; acota la tabla de tramos de las esquinas. */
+#define SHAPE_MAX_RADIUS 160
+
+enum GfxShapeKind : uint8_t {
+  GFX_SHAPE_ROUNDRECT,  // También círculos: lado 2r+1 y radio r
+  GFX_SHAPE_TRIANGLE
+};
+
+/**
+ * Figura descrita por sus tramos horizontales. Las esquinas redondeadas usan
+ * una tabla (2 * (r + 1) bytes) que sigue a la estructura: extremo exterior e
+ * interior, por distancia vertical al centro de la esquina.
+ */
+struct GfxShape {
+  uint8_t kind;
+  uint8_t outline;
+  int16_t x, y, w, h;  // Recuadro sin recortar
+  int16_t r;
+  int16_t tx[3], ty[3];  // Triángulo, ordenado por y
+};
+
+GfxShape ST7789_Graphics::roundRectShape(int x, int y, int w, int h, int r, bool outline) {
+  GfxShape shape = {};
+  shape.kind = GFX_SHAPE_ROUNDRECT;
+  shape.outline = outline;
+  shape.x = x;
+  shape.y = y;
+  shape.w = w;
+  shape.h = h;
+  r = min(r, min(w, h) / 2);
+  shape.r = constrain(r, 0, SHAPE_MAX_RADIUS);
+  return shape;
+}
+
+/**
+ * Rellena outer/inner para una esquina de radio r con el mismo algoritmo del
+ * punto medio que usaban los círculos píxel a píxel, para conservar su forma.
+ */
+static void buildCornerTable(int r, bool outline, uint8_t* outer, uint8_t* inner) {
+  int16_t height[SHAPE_MAX_RADIUS + 1];  // Relleno: alto cubierto por cada columna
+  for (int i = 0; i <= r; i++) {
+    height[i] = -1;
+    outer[i] = 0;
+    inner[i] = 0xFF;
+  }
+
+  // Puntos del arco (y, para el relleno, la columna central y los lados rectos)
+  auto plot = [&](int dx, int dy) {
+    if (dx > r || dy > r) return;
+    if (outline) {
+      if (dx > outer[dy]) outer[dy] = dx;
+      if (dx < inner[dy]) inner[dy] = dx;
+    } else if (dy > height[dx]) {
+      height[dx] = dy;
+    }
+  };
+  plot(0, r);
+  plot(r, 0);
+
+  int f = 1 - r;
+  int ddF_x = 1;
+  int ddF_y = -2 * r;
+  int x = 0;
+  int y = r;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    plot(x, y);
+    plot(y, x);
+  }
+
+  if (!outline) {
+    // Extremo de cada fila: última columna que llega a esa altura
+    for (int dy = 0; dy <= r; dy++) {
+      outer[dy] = 0;
+      for (int dx = r; dx >= 0; dx--) {
+        if (height[dx] >= dy) {
+          outer[dy] = dx;
+          break;
+        }
+      }
+      inner[dy] = 0;
+    }
+  }
+}
+
+/** Tramos [x0, x1) de la figura en la fila y, recortados a [left, right). Devuelve 0..2. */
+static int shapeRowSpans(const GfxShape& s, const uint8_t* table, int y, int left, int right, int16_t* x0, int16_t* x1) {
+  int a[2], b[2];  // Extremos inclusivos
+  int n = 0;
+
+  if (s.kind == GFX_SHAPE_TRIANGLE) {
+    int ax0 = s.tx[0], ay0 = s.ty[0], ax1 = s.tx[1], ay1 = s.ty[1], ax2 = s.tx[2], ay2 = s.ty[2];
+    if (y < ay0 || y > ay2) return 0;
+    int l, r;
+    if (ay0 == ay2) {
+      l = min(ax0, min(ax1, ax2));
+      r = max(ax0, max(ax1, ax2));
+    } else {
+      // Mismos redondeos que el relleno por líneas horizontales
+      int last = (ay1 == ay2) ? ay1 : ay1 - 1;
+      if (y <= last) l = ax0 + (ax1 - ax0) * (y - ay0) / (ay1 - ay0);
+      else l = ax1 + (ax2 - ax1) * (y - ay1) / (ay2 - ay1);
+      r = ax0 + (ax2 - ax0) * (y - ay0) / (ay2 - ay0);
+      if (l > r) {
+        int t = l;
+        l = r;
+        r = t;
+      }
+    }
+    a[n] = l;
+    b[n++] = r;
+  } else {
+    if (y < s.y || y >= s.y + s.h) return 0;
+    int r = s.r;
+    int cx0 = s.x + r, cx1 = s.x + s.w - r - 1;
+    int cy0 = s.y + r, cy1 = s.y + s.h - r - 1;
+    const uint8_t* outer = table;
+    const uint8_t* inner = table + r + 1;
+
+    if (y > cy0 && y < cy1) {
+      // Zona recta entre esquinas
+      if (s.outline) {
+        a[n] = s.x; b[n++] = s.x;
+        a[n] = s.x + s.w - 1; b[n++] = s.x + s.w - 1;
+      } else {
+        a[n] = s.x; b[n++] = s.x + s.w - 1;
+      }
+    } else {
+      int dy = (y <= cy0) ? cy0 - y : y - cy1;
+      if (!s.outline || dy == r) {
+        // Relleno, o borde superior/inferior: la recta une ambas esquinas
+        a[n] = cx0 - outer[dy]; b[n++] = cx1 + outer[dy];
+      } else if (inner[dy] != 0xFF) {
+        a[n] = cx0 - outer[dy]; b[n++] = cx0 - inner[dy];
+        a[n] = cx1 + inner[dy]; b[n++] = cx1 + outer[dy];
+      }
+    }
+    if (n == 2 && b[0] + 1 >= a[1]) {
+      b[0] = b[1];
+      n = 1;
+    }
+  }
+
+  int out = 0;
+  for (int i = 0; i < n; i++) {
+    int l = max(a[i], left), r = min(b[i] + 1, right);
+    if (l >= r) continue;
+    x0[out] = l;
+    x1[out++] = r;
+  }
+  return out;
+}
+
+// ---------------------------------------------------------------------------
+// Renderizado por franjas con lista de dibujo
+// ---------------------------------------------------------------------------
+
+// FNV-1a de 32 bits para el resumen por baldosa de enableFrameDiff()
+static constexpr uint32_t FNV_OFFSET = 2166136261u;
+static constexpr uint32_t FNV_PRIME = 16777619u;
 
-  uint16_t colorBuffer[width];
-  for (int i = 0; i < width; i++) {
-    colorBuffer[i] = color;
+static_assert(DIFF_TILE_COLS <= 16, "las columnas de baldosas deben caber en una máscara de 16 bits");
+
+static inline uint32_t fnvBytes(uint32_t h, const void* data, uint32_t bytes) {
+  const uint8_t* p = (const uint8_t*)data;
+  for (uint32_t i = 0; i < bytes; i++) h = (h ^ p[i]) * FNV_PRIME;
+  return h;
+}
+
+bool ST7789_Graphics::beginFrame() {
+  if (framebuffer || indexedBuffer) return true;
+  if (!dlOps) {
+    dlOps = (GfxOp*)heap_caps_malloc(DL_MAX_OPS * sizeof(GfxOp), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    dlArena = (uint8_t*)heap_caps_malloc(DL_ARENA_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!dlOps || !dlArena) {
+      heap_caps_free(dlOps);
+      heap_caps_free(dlArena);
+      dlOps = nullptr;
+      dlArena = nullptr;
+      return false;
+    }
   }
+  dlCount = 0;
+  dlArenaUsed = 0;
+  dlRecording = true;
+  if (frameDiff) {
+    for (int i = 0; i < DIFF_TILE_ROWS * DIFF_TILE_COLS; i++) tileHash[i] = FNV_OFFSET;
+    frameSkipTiles = !tilesStale;
+    tilesStale = false;
+  }
+  return true;
+}
 
-  for (int i = 0; i < height; i++) {
-    LCD_addWindow(x, y + i, x + width - 1, y + i, colorBuffer);
+void ST7789_Graphics::endFrame() {
+  if (framebuffer || indexedBuffer) {
+    flush();
+    return;
   }
+  if (!dlRecording) return;
+  renderDisplayList(true);
+  dlRecording = false;
+  if (frameDiff) memcpy(prevTileHash, tileHash, sizeof(tileHash));
 }
 
-void ST7789_Graphics::drawHLine(int x, int y, int width, uint16_t color) {
+void ST7789_Graphics::enableFrameDiff(bool enable) {
+  frameDiff = enable;
+  tilesStale = true;
+}
+
+/**
+ * Añade una operación a la lista reservando dataBytes en la arena.
+ * Si no hay sitio, renderiza lo grabado hasta ahora y vacía la lista;
+ * devuelve nullptr sólo si la operación no cabría ni con la lista vacía.
+ */
+GfxOp* ST7789_Graphics::recordOp(uint8_t type, int x, int y, int w, int h, uint32_t dataBytes) {
+  uint32_t used = dataBytes;
+  dataBytes = (dataBytes + 3) & ~3u;
+  if (dataBytes > DL_ARENA_BYTES) {
+    renderDisplayList();
+    return nullptr;
+  }
+  if (dlCount == DL_MAX_OPS || dlArenaUsed + dataBytes > DL_ARENA_BYTES) {
+    renderDisplayList();
+  }
+  GfxOp* op = &dlOps[dlCount++];
+  op->type = type;
+  op->x = x;
+  op->y = y;
+  op->w = w;
+  op->h = h;
+  op->data = dlArenaUsed;
+  // Relleno de alineación a cero: el resumen del cuadro incluye toda la arena
+  memset(dlArena + dlArenaUsed + used, 0, dataBytes - used);
+  dlArenaUsed += dataBytes;
+  return op;
+}
+
+/** Cabecera en la arena de una operación GFX_OP_ROWS; le sigue el contexto. */
+struct RowOpHeader {
+  GfxRowGenerator gen;
+  int16_t ox, oy;  // Origen sin recortar del bloque generado
+};
+
+/** Tramos [x0, x1) que cubre la operación en la fila y (como mucho 2). */
+int ST7789_Graphics::opRowSpans(const GfxOp& op, int y, int16_t* x0, int16_t* x1) {
+  if (y < op.y || y >= op.y + op.h) return 0;
+  if (op.type == GFX_OP_SHAPE) {
+    const GfxShape* shape = (const GfxShape*)(dlArena + op.data);
+    return shapeRowSpans(*shape, (const uint8_t*)(shape + 1), y, op.x, op.x + op.w, x0, x1);
+  }
+  x0[0] = op.x;
+  x1[0] = op.x + op.w;
+  return 1;
+}
+
+/** Pinta la parte de la operación que cae en [x0, x1) de la fila y; dst apunta a x0. */
+void ST7789_Graphics::renderOpRow(const GfxOp& op, int y, int x0, int x1, uint16_t* dst) {
+  int16_t sa[2], sb[2];
+  int spans = opRowSpans(op, y, sa, sb);
+  for (int k = 0; k < spans; k++) {
+    int a = max((int)sa[k], x0);
+    int b = min((int)sb[k], x1);
+    if (a >= b) continue;
+
+    switch (op.type) {
+      case GFX_OP_FILL:
+      case GFX_OP_SHAPE:
+        for (int i = a; i < b; i++) dst[i - x0] = op.color.raw;
+        break;
+      case GFX_OP_PIXELS: {
+        const uint16_t* src = (const uint16_t*)(dlArena + op.data) + (y - op.y) * op.w + (a - op.x);
+        memcpy(dst + (a - x0), src, (b - a) * sizeof(uint16_t));
+        break;
+      }
+      case GFX_OP_ROWS: {
+        const RowOpHeader* hdr = (const RowOpHeader*)(dlArena + op.data);
+        hdr->gen(hdr + 1, y - hdr->oy, a - hdr->ox, b - hdr->ox, dst + (a - x0));
+        break;
+      }
+    }
+  }
+}
+
+/** Tramos cubiertos de una fila, ordenados y fusionados. */
+struct RowSpans {
+  int count;
+  int16_t x0[DL_MAX_OPS * 2];
+  int16_t x1[DL_MAX_OPS * 2];
+};
+
+static bool sameSpans(const RowSpans& a, const RowSpans& b) {
+  if (a.count != b.count) return false;
+  for (int i = 0; i < a.count; i++) {
+    if (a.x0[i] != b.x0[i] || a.x1[i] != b.x1[i]) return false;
+  }
+  return true;
+}
+
+/**
+ * Mezcla cada operación grabada (en orden de dibujo) en el resumen de las
+ * baldosas que toca. Los datos de una operación van hasta el inicio de la
+ * siguiente en la arena.
+ */
+void ST7789_Graphics::hashDisplayList() {
+  for (int i = 0; i < dlCount; i++) {
+    const GfxOp& op = dlOps[i];
+    uint32_t end = (i + 1 < dlCount) ? dlOps[i + 1].data : dlArenaUsed;
+    uint32_t h = FNV_OFFSET;
+    h = fnvBytes(h, &op.type, sizeof(op.type));
+    h = fnvBytes(h, &op.color, sizeof(op.color));
+    h = fnvBytes(h, &op.x, sizeof(op.x));
+    h = fnvBytes(h, &op.y, sizeof(op.y));
+    h = fnvBytes(h, &op.w, sizeof(op.w));
+    h = fnvBytes(h, &op.h, sizeof(op.h));
+    h = fnvBytes(h, dlArena + op.data, end - op.data);
+
+    int col0 = op.x / DIFF_TILE_WIDTH, col1 = (op.x + op.w - 1) / DIFF_TILE_WIDTH;
+    int row0 = op.y / BAND_HEIGHT, row1 = (op.y + op.h - 1) / BAND_HEIGHT;
+    for (int row = row0; row <= row1; row++) {
+      uint32_t* tiles = tileHash + row * DIFF_TILE_COLS;
+      for (int col = col0; col <= col1; col++) tiles[col] = (tiles[col] ^ h) * FNV_PRIME;
+    }
+  }
+}
+
+/** Recorta los tramos de una fila a las columnas de baldosas marcadas en `cols`. */
+static void maskSpans(RowSpans& rs, uint16_t cols) {
+  static RowSpans out;
+  out.count = 0;
+  for (int col = 0; col < DIFF_TILE_COLS; col++) {
+    if (!(cols & (1u << col))) continue;
+    int first = col;
+    while (col + 1 < DIFF_TILE_COLS && (cols & (1u << (col + 1)))) col++;
+    int a = first * DIFF_TILE_WIDTH, b = min((col + 1) * DIFF_TILE_WIDTH, SCREEN_WIDTH);
+    for (int j = 0; j < rs.count; j++) {
+      int x0 = max((int)rs.x0[j], a), x1 = min((int)rs.x1[j], b);
+      if (x0 >= x1) continue;
+      out.x0[out.count] = x0;
+      out.x1[out.count] = x1;
+      out.count++;
+    }
+  }
+  rs.count = out.count;
+  memcpy(rs.x0, out.x0, out.count * sizeof(int16_t));
+  memcpy(rs.x1, out.x1, out.count * sizeof(int16_t));
+}
+
+/**
+ * Rasteriza y envía la lista. Con enableFrameDiff() y al cerrar un cuadro que
+ * no se vació antes, omite las baldosas cuyo resumen coincide con el anterior;
+ * si la lista se llenó a mitad de cuadro, el cuadro se envía entero.
+ */
+void ST7789_Graphics::renderDisplayList(bool endOfFrame) {
+  static uint16_t changedCols[DIFF_TILE_ROWS];
+  bool skipTiles = false;
+  if (frameDiff && dlRecording) {
+    hashDisplayList();
+    skipTiles = endOfFrame && frameSkipTiles;
+    if (!endOfFrame) frameSkipTiles = false;
+    if (skipTiles) {
+      for (int row = 0; row < DIFF_TILE_ROWS; row++) {
+        uint16_t cols = 0;
+        for (int col = 0; col < DIFF_TILE_COLS; col++) {
+          int t = row * DIFF_TILE_COLS + col;
+          if (tileHash[t] != prevTileHash[t]) cols |= 1u << col;
+        }
+        changedCols[row] = cols;
+      }
+    }
+  }
+
+  if (dlCount == 0) {
+    dlArenaUsed = 0;
+    return;
+  }
+
+  int top = SCREEN_HEIGHT, bottom = 0;
+  for (int i = 0; i < dlCount; i++) {
+    if (dlOps[i].y < top) top = dlOps[i].y;
+    if (dlOps[i].y + dlOps[i].h > bottom) bottom = dlOps[i].y + dlOps[i].h;
+  }
+
+  static uint16_t active[DL_MAX_OPS];
+  static RowSpans spans[2];
+  uint16_t scratch[SCREEN_WIDTH];
+
+  for (int bandY = top; bandY < bottom; bandY += BAND_HEIGHT) {
+    int bandEnd = min(bandY + BAND_HEIGHT, bottom);
+
+    // Operaciones que tocan la franja, en orden de dibujo
+    int activeCount = 0;
+    for (int i = 0; i < dlCount; i++) {
+      const GfxOp& op = dlOps[i];
+      if (op.y < bandEnd && op.y + op.h > bandY) active[activeCount++] = i;
+    }
+    if (activeCount == 0) continue;
+
+    // Agrupar filas consecutivas con los mismos tramos cubiertos: cada tramo
+    // de cada grupo es una ventana. Los píxeles no cubiertos no se envían.
+    int runStart = bandY;
+    int cur = 0;
+    for (int y = bandY; y <= bandEnd; y++) {
+      RowSpans& rs = spans[cur ^ 1];
+      rs.count = 0;
+      if (y < bandEnd) {
+        for (int k = 0; k < activeCount; k++) {
+          int16_t sa[2], sb[2];
+          int spans = opRowSpans(dlOps[active[k]], y, sa, sb);
+          for (int m = 0; m < spans; m++) {
+            // Inserción ordenada por inicio
+            int j = rs.count++;
+            while (j > 0 && rs.x0[j - 1] > sa[m]) {
+              rs.x0[j] = rs.x0[j - 1];
+              rs.x1[j] = rs.x1[j - 1];
+              j--;
+            }
+            rs.x0[j] = sa[m];
+            rs.x1[j] = sb[m];
+          }
+        }
+        // Fusionar tramos solapados o contiguos
+        int n = 0;
+        for (int j = 0; j < rs.count; j++) {
+          if (n > 0 && rs.x0[j] <= rs.x1[n - 1]) {
+            if (rs.x1[j] > rs.x1[n - 1]) rs.x1[n - 1] = rs.x1[j];
+          } else {
+            rs.x0[n] = rs.x0[j];
+            rs.x1[n] = rs.x1[j];
+            n++;
+          }
+        }
+        rs.count = n;
+        if (skipTiles) {
+          uint16_t cols = changedCols[y / BAND_HEIGHT];
+          if (cols == 0) rs.count = 0;
+          else if (cols != (1u << DIFF_TILE_COLS) - 1) maskSpans(rs, cols);
+        }
+      }
+
+      if (y > bandY && y < bandEnd && sameSpans(rs, spans[cur])) continue;
+
+      // Emitir el grupo anterior [runStart, y)
+      if (y > bandY) {
+        const RowSpans& run = spans[cur];
+        for (int j = 0; j < run.count; j++) {
+          int x0 = run.x0[j], x1 = run.x1[j];
+          uint32_t width = x1 - x0;
+          LCD_BeginWindow(x0, runStart, x1 - 1, y - 1);
+          for (int row = runStart; row < y; row++) {
+            // Rasterizar sobre el buffer DMA si la fila cabe entera
+            uint32_t avail;
+            uint16_t* dst = LCD_StreamReserve(&avail);
+            bool inPlace = avail >= width;
+            if (!inPlace) dst = scratch;
+            for (int k = 0; k < activeCount; k++) {
+              renderOpRow(dlOps[active[k]], row, x0, x1, dst);
+            }
+            if (inPlace) LCD_StreamCommit(width);
+            else LCD_PushPixels(scratch, width);
+          }
+          LCD_EndWindow();
+        }
+      }
+      runStart = y;
+      cur ^= 1;
+    }
+  }
+
+  dlCount = 0;
+  dlArenaUsed = 0;
+}
+
+/**
+ * Rasteriza una figura. Con framebuffer o lista de dibujo es exacta por filas;
+ * en modo directo las filas consecutivas con los mismos tramos comparten
+ * ventana (el cuerpo de un botón redondeado es una sola ventana).
+ */
+void ST7789_Graphics::rasterShape(const GfxShape& local, PanelColor color) {
+  if (local.w <= 0 || local.h <= 0) return;
+
+  // A coordenadas de pantalla
+  GfxShape shape = local;
+  shape.x += clipState.originX;
+  shape.y += clipState.originY;
+  for (int i = 0; i < 3; i++) {
+    shape.tx[i] += clipState.originX;
+    shape.ty[i] += clipState.originY;
+  }
+
+  uint8_t table[2 * (SHAPE_MAX_RADIUS + 1)];
+  uint32_t tableBytes = 0;
+  if (shape.kind == GFX_SHAPE_ROUNDRECT) {
+    buildCornerTable(shape.r, shape.outline, table, table + shape.r + 1);
+    tableBytes = 2 * (shape.r + 1);
+  }
+
+  const GfxRect& c = clipState.clip;
+  int top = max((int)shape.y, (int)c.y);
+  int bottom = min(shape.y + shape.h, c.y + c.h);
+  int left = max((int)shape.x, (int)c.x);
+  int right = min(shape.x + shape.w, c.x + c.w);
+  if (top >= bottom || left >= right) return;
+
+  int16_t sa[2], sb[2];
+  if (framebuffer || indexedBuffer) {
+    for (int y = top; y < bottom; y++) {
+      int spans = shapeRowSpans(shape, table, y, left, right, sa, sb);
+      for (int k = 0; k < spans; k++) bufferFill(sa[k], y, sb[k] - sa[k], 1, color);
+    }
+    markDirty(left, top, right - left, bottom - top);
+    return;
+  }
+
+  if (dlRecording) {
+    GfxOp* op = recordOp(GFX_OP_SHAPE, left, top, right - left, bottom - top, sizeof(GfxShape) + tableBytes);
+    if (op) {
+      op->color = color;
+      memcpy(dlArena + op->data, &shape, sizeof(GfxShape));
+      memcpy(dlArena + op->data + sizeof(GfxShape), table, tableBytes);
+      return;
+    }
+  }
+  tilesStale = true;
+
+  // Agrupar filas con tramos idénticos en una ventana por tramo
+  int16_t runA[2], runB[2];
+  int runCount = 0;
+  int runStart = top;
+  for (int y = top; y <= bottom; y++) {
+    int spans = (y < bottom) ? shapeRowSpans(shape, table, y, left, right, sa, sb) : 0;
+    bool same = (y < bottom) && spans == runCount;
+    for (int k = 0; same && k < spans; k++) {
+      same = sa[k] == runA[k] && sb[k] == runB[k];
+    }
+    if (same && y > top) continue;
+
+    for (int k = 0; k < runCount; k++) {
+      LCD_BeginWindow(runA[k], runStart, runB[k] - 1, y - 1);
+      LCD_PushColor(color, (uint32_t)(runB[k] - runA[k]) * (y - runStart));
+      LCD_EndWindow();
+    }
+    runCount = spans;
+    for (int k = 0; k < spans; k++) {
+      runA[k] = sa[k];
+      runB[k] = sb[k];
+    }
+    runStart = y;
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Capa de rasterizado: todas las primitivas terminan aquí
+// ---------------------------------------------------------------------------
+
+void ST7789_Graphics::rasterFill(int x, int y, int w, int h, PanelColor color) {
+  if (!clipToScreen(x, y, w, h)) return;
+
+  if (framebuffer || indexedBuffer) {
+    bufferFill(x, y, w, h, color);
+    markDirty(x, y, w, h);
+    return;
+  }
+
+  if (dlRecording) {
+    GfxOp* op = recordOp(GFX_OP_FILL, x, y, w, h, 0);
+    op->color = color;
+    return;
+  }
+
+  tilesStale = true;
+  LCD_BeginWindow(x, y, x + w - 1, y + h - 1);
+  LCD_PushColor(color, (uint32_t)w * h);
+  LCD_EndWindow();
+}
+
+void ST7789_Graphics::rasterPixels(int x, int y, int w, int h, const uint16_t* pixels) {
+  int stride = w;
+  int ox = x + clipState.originX, oy = y + clipState.originY;
+  if (!clipToScreen(x, y, w, h)) return;
+  pixels += (y - oy) * stride + (x - ox);
+
+  if (framebuffer) {
+    for (int row = 0; row < h; row++) {
+      memcpy(framebuffer + (y + row) * SCREEN_WIDTH + x, pixels + row * stride, w * sizeof(uint16_t));
+    }
+    markDirty(x, y, w, h);
+    return;
+  }
+
+  if (indexedBuffer) {
+    for (int row = 0; row < h; row++) {
+      storeIndexed(x, y + row, w, pixels + row * stride);
+    }
+    markDirty(x, y, w, h);
+    return;
+  }
+
+  if (dlRecording) {
+    // Un bloque mayor que la arena se envía directo tras vaciar la lista
+    GfxOp* op = recordOp(GFX_OP_PIXELS, x, y, w, h, (uint32_t)w * h * sizeof(uint16_t));
+    if (op) {
+      uint16_t* dst = (uint16_t*)(dlArena + op->data);
+      for (int row = 0; row < h; row++) {
+        memcpy(dst + row * w, pixels + row * stride, w * sizeof(uint16_t));
+      }
+      return;
+    }
+  }
+
+  tilesStale = true;
+  LCD_BeginWindow(x, y, x + w - 1, y + h - 1);
+  for (int row = 0; row < h; row++) {
+    LCD_PushPixels(pixels + row * stride, w);
+  }
+  LCD_EndWindow();
+}
+
+/**
+ * Bloque cuyas filas produce un generador. En modo directo las filas se
+ * generan sobre el buffer DMA; con lista de dibujo se copia el contexto.
+ */
+void ST7789_Graphics::rasterRows(int x, int y, int w, int h, GfxRowGenerator gen, const void* ctx, uint32_t ctxBytes) {
+  int ox = x + clipState.originX, oy = y + clipState.originY;
+  if (!clipToScreen(x, y, w, h)) return;
+
+  if (framebuffer) {
+    for (int row = 0; row < h; row++) {
+      gen(ctx, y + row - oy, x - ox, x + w - ox, framebuffer + (y + row) * SCREEN_WIDTH + x);
+    }
+    markDirty(x, y, w, h);
+    return;
+  }
+
+  uint16_t scratch[SCREEN_WIDTH];
+  if (indexedBuffer) {
+    for (int row = 0; row < h; row++) {
+      gen(ctx, y + row - oy, x - ox, x + w - ox, scratch);
+      storeIndexed(x, y + row, w, scratch);
+    }
+    markDirty(x, y, w, h);
+    return;
+  }
+
+  if (dlRecording) {
+    GfxOp* op = recordOp(GFX_OP_ROWS, x, y, w, h, sizeof(RowOpHeader) + ctxBytes);
+    if (op) {
+      RowOpHeader* hdr = (RowOpHeader*)(dlArena + op->data);
+      hdr->gen = gen;
+      hdr->ox = ox;
+      hdr->oy = oy;
+      memcpy(hdr + 1, ctx, ctxBytes);
+      return;
+    }
+  }
+
+  tilesStale = true;
+  LCD_BeginWindow(x, y, x + w - 1, y + h - 1);
+  for (int row = 0; row < h; row++) {
+    uint32_t avail;
+    uint16_t* dst = LCD_StreamReserve(&avail);
+    if (avail >= (uint32_t)w) {
+      gen(ctx, y + row - oy, x - ox, x + w - ox, dst);
+      LCD_StreamCommit(w);
+    } else {
+      gen(ctx, y + row - oy, x - ox, x + w - ox, scratch);
+      LCD_PushPixels(scratch, w);
+    }
+  }
+  LCD_EndWindow();
+}
+
+/** Rellena un rectángulo ya recortado en el framebuffer activo (sin marcarlo sucio). */
+void ST7789_Graphics::bufferFill(int x, int y, int w, int h, PanelColor color) {
+  if (framebuffer) {
+    for (int row = 0; row < h; row++) {
+      uint16_t* dst = framebuffer + (y + row) * SCREEN_WIDTH + x;
+      for (int i = 0; i < w; i++) dst[i] = color.raw;
+    }
+    return;
+  }
+
+  uint8_t index = paletteIndex(color);
+  uint8_t both = index | (index << 4);
+  for (int row = 0; row < h; row++) {
+    uint8_t* line = indexedBuffer + (y + row) * (SCREEN_WIDTH / 2);
+    int px = x, end = x + w;
+    if (px & 1) {
+      line[px / 2] = (line[px / 2] & 0x0F) | (index << 4);
+      px++;
+    }
+    int bytes = (end - px) / 2;
+    memset(line + px / 2, both, bytes);
+    px += bytes * 2;
+    if (px < end) line[px / 2] = (line[px / 2] & 0xF0) | index;
+  }
+}
+
+/** Traduce una fila (orden del panel) a índices de paleta en el framebuffer indexado. */
+void ST7789_Graphics::storeIndexed(int x, int y, int w, const uint16_t* src) {
+  uint8_t* line = indexedBuffer + y * (SCREEN_WIDTH / 2);
+  for (int i = 0; i < w; i++) {
+    int px = x + i;
+    uint8_t index = paletteIndex(PanelColor{src[i]});
+    if (px & 1) line[px / 2] = (line[px / 2] & 0x0F) | (index << 4);
+    else        line[px / 2] = (line[px / 2] & 0xF0) | index;
+  }
+}
+
+void ST7789_Graphics::drawHLine(int x, int y, int width, PanelColor color) {
   fillRect(x, y, width, 1, color);
 }
 
-void ST7789_Graphics::drawVLine(int x, int y, int height, uint16_t color) {
+void ST7789_Graphics::drawVLine(int x, int y, int height, PanelColor color) {
   fillRect(x, y, 1, height, color);
 }
 
-void ST7789_Graphics::drawRect(int x, int y, int width, int height, uint16_t color) {
+void ST7789_Graphics::drawRect(int x, int y, int width, int height, PanelColor color) {
   drawHLine(x, y, width, color);               // Top
   drawHLine(x, y + height - 1, width, color);  // Bottom
   drawVLine(x, y, height, color);              // Left
   drawVLine(x + width - 1, y, height, color);  // Right
 }
 
-void ST7789_Graphics::drawLine(int x0, int y0, int x1, int y1, uint16_t color) {
+void ST7789_Graphics::drawLine(int x0, int y0, int x1, int y1, PanelColor color) {
   if (!initialized) return;
 
+  // Horizontales y verticales: un solo rectángulo
+  if (y0 == y1) {
+    rasterFill(min(x0, x1), y0, abs(x1 - x0) + 1, 1, color);
+    return;
+  }
+  if (x0 == x1) {
+    rasterFill(x0, min(y0, y1), 1, abs(y1 - y0) + 1, color);
+    return;
+  }
+
   int dx = abs(x1 - x0);
   int dy = abs(y1 - y0);
   int sx = (x0 < x1) ? 1 : -1;
   int sy = (y0 < y1) ? 1 : -1;
+
+  // Bresenham agrupando los píxeles consecutivos del eje mayor en tramos:
+  // horizontales si la línea es más ancha que alta, verticales si no.
+  bool horizontal = dx > dy;
   int err = dx - dy;
+  int runX = x0, runY = y0, runLen = 0;
 
   while (true) {
-    drawPixel(x0, y0, color);
+    bool contiguous = horizontal ? (y0 == runY && x0 == runX + sx * runLen)
+                                 : (x0 == runX && y0 == runY + sy * runLen);
+    if (!contiguous) {
+      flushLineRun(runX, runY, runLen, horizontal, horizontal ? sx : sy, color);
+      runX = x0;
+      runY = y0;
+      runLen = 0;
+    }
+    runLen++;
 
     if (x0 == x1 && y0 == y1) break;
 
@@ -260,136 +1278,348 @@ void ST7789_Graphics::drawLine(int x0, int y0, int x1, int y1, uint16_t color) {
       y0 += sy;
     }
   }
+  flushLineRun(runX, runY, runLen, horizontal, horizontal ? sx : sy, color);
 }
 
-void ST7789_Graphics::drawCircle(int x, int y, int radius, uint16_t color) {
+/** Dibuja un tramo de línea de `len` píxeles desde (x, y) en la dirección `step` (±1). */
+void ST7789_Graphics::flushLineRun(int x, int y, int len, bool horizontal, int step, PanelColor color) {
+  if (len <= 0) return;
+  if (horizontal) {
+    rasterFill(step > 0 ? x : x - len + 1, y, len, 1, color);
+  } else {
+    rasterFill(x, step > 0 ? y : y - len + 1, 1, len, color);
+  }
+}
+
+void ST7789_Graphics::drawCircle(int x, int y, int radius, PanelColor color) {
   if (!initialized) return;
+  rasterShape(roundRectShape(x - radius, y - radius, 2 * radius + 1, 2 * radius + 1, radius, true), color);
+}
 
-  int f = 1 - radius;
-  int ddF_x = 1;
-  int ddF_y = -2 * radius;
-  int x1 = 0;
-  int y1 = radius;
+void ST7789_Graphics::fillCircle(int x, int y, int radius, PanelColor color) {
+  if (!initialized) return;
+  rasterShape(roundRectShape(x - radius, y - radius, 2 * radius + 1, 2 * radius + 1, radius, false), color);
+}
+
+void ST7789_Graphics::drawChar(int x, int y, char c, PanelColor textColor, PanelColor bgColor, uint8_t size) {
+  if (!initialized) return;
+  if (c < 0 || c > 127) return;  // Solo caracteres imprimibles
 
-  drawPixel(x, y + radius, color);
-  drawPixel(x, y - radius, color);
-  drawPixel(x + radius, y, color);
-  drawPixel(x - radius, y, color);
+  if (currentFont) {
+    char one[2] = {c, '\0'};
+    blitFontText(x, y, one, textColor, bgColor);
+    return;
+  }
 
-  while (x1 < y1) {
-    if (f >= 0) {
-      y1--;
-      ddF_y += 2;
-      f += ddF_y;
+  blitText(x, y, &c, 1, textColor, bgColor, size);
+}
+
+void ST7789_Graphics::drawText(int x, int y, const String& text, PanelColor textColor, PanelColor bgColor, uint8_t size) {
+  drawText(x, y, text.c_str(), textColor, bgColor, size);
+}
+
+void ST7789_Graphics::drawText(int x, int y, const char* text, PanelColor textColor, PanelColor bgColor, uint8_t size) {
+  if (!initialized || !text) return;
+
+  if (currentFont) {
+    blitFontText(x, y, text, textColor, bgColor);
+    return;
+  }
+
+  int charWidth = getCharWidth(size);
+
+  // Sólo caracteres completos, como el dibujo carácter a carácter
+  int len = 0;
+  while (text[len] != '\0' && clipState.originX + x + (len + 1) * charWidth <= SCREEN_WIDTH) len++;
+  blitText(x, y, text, len, textColor, bgColor, size);
+}
+
+/** Cadena preparada para textRowGenerator; los caracteres van a continuación. */
+struct TextRun {
+  PanelColor textColor;
+  PanelColor bgColor;
+  uint8_t size;
+  uint8_t len;
+  GlyphCache* cache;  // Celdas ya rasterizadas (nullptr: expandir la fuente)
+};
+
+/** Longitud máxima de una pasada del blitter (más que de sobra para 320 px). */
+#define TEXT_RUN_MAX 64
+
+void ST7789_Graphics::textRowGenerator(const void* ctx, int row, int x0, int x1, uint16_t* dst) {
+  const TextRun* run = (const TextRun*)ctx;
+  const char* chars = (const char*)(run + 1);
+  int size = run->size;
+  int cellWidth = 6 * size;
+  int glyphRow = row / size;
+
+  int px = x0;
+  while (px < x1) {
+    int ci = px / cellWidth;
+
+    if (run->cache) {
+      const uint16_t* cell = run->cache->peek(chars[ci], run->textColor.raw, run->bgColor.raw, size);
+      if (cell) {
+        int end = (ci + 1) * cellWidth;
+        if (end > x1) end = x1;
+        memcpy(dst, cell + row * cellWidth + (px - ci * cellWidth), (end - px) * sizeof(uint16_t));
+        dst += end - px;
+        px = end;
+        continue;
+      }
     }
-    x1++;
-    ddF_x += 2;
-    f += ddF_x;
 
-    drawPixel(x + x1, y + y1, color);
-    drawPixel(x - x1, y + y1, color);
-    drawPixel(x + x1, y - y1, color);
-    drawPixel(x - x1, y - y1, color);
-    drawPixel(x + y1, y + x1, color);
-    drawPixel(x - y1, y + x1, color);
-    drawPixel(x + y1, y - x1, color);
-    drawPixel(x - y1, y - x1, color);
+    int col = (px - ci * cellWidth) / size;   // 0..4 glifo, 5 separación
+    uint8_t c = (uint8_t)chars[ci];
+    uint8_t line = (c < 128) ? font5x8[c][glyphRow] : 0;
+    uint16_t color = (col < 5 && (line & (0x10 >> col))) ? run->textColor.raw : run->bgColor.raw;
+
+    int end = ci * cellWidth + (col + 1) * size;
+    if (end > x1) end = x1;
+    while (px < end) {
+      *dst++ = color;
+      px++;
+    }
   }
 }
 
-void ST7789_Graphics::fillCircle(int x, int y, int radius, uint16_t color) {
-  drawVLine(x, y - radius, 2 * radius + 1, color);
-  fillCircleHelper(x, y, radius, 3, 0, color);
+bool ST7789_Graphics::enableGlyphCache(uint32_t bytes) {
+  // Las operaciones grabadas pueden apuntar a la caché: vaciarlas antes
+  if (dlRecording) renderDisplayList();
+  if (bytes == 0) {
+    glyphCache.end();
+    return true;
+  }
+  return glyphCache.begin(bytes);
 }
 
-void ST7789_Graphics::drawChar(int x, int y, char c, uint16_t textColor, uint16_t bgColor, uint8_t size) {
-  if (!initialized) return;
-  if (c < 0 || c > 127) return;  // Solo caracteres imprimibles
+/** Garantiza que la celda del carácter esté en la caché (cuenta acierto o fallo). */
+void ST7789_Graphics::cacheGlyph(uint8_t c, PanelColor textColor, PanelColor bgColor, uint8_t size) {
+  if (glyphCache.lookup(c, textColor.raw, bgColor.raw, size)) return;
 
-  int charIndex = c;  // Ajustar índice
-
-  for (int row = 0; row < 8; row++) {
-    uint8_t line = font5x8[charIndex][row];
-    for (int col = 0; col < 5; col++) {
-      if (line & (0x10 >> col)) {
-        // Pixel del carácter
-        if (size == 1) {
-          drawPixel(x + col, y + row, textColor);
-        } else {
-          // Dibujar bloque escalado
-          int bx = x + col * size;
-          int by = y + row * size;
-          fillRect(bx, by, size, size, textColor);
-          // Suavizado ligero: si está habilitado, dibujar píxeles vecinos semi-translúcidos
-          if (textAAEnabled) {
-            // Ajuste simple: dibujar un contorno de 1 píxel mezclado alrededor del bloque
-            // mezclando textColor y bgColor al 50% para simular anti-alias
-            uint16_t blend = interpolateColor(textColor, bgColor, 0.5f);
-            // izquierda
-            fillRect(bx - 1, by, 1, size, blend);
-            // derecha
-            fillRect(bx + size, by, 1, size, blend);
-            // arriba
-            fillRect(bx, by - 1, size, 1, blend);
-            // abajo
-            fillRect(bx, by + size, size, 1, blend);
-            // esquinas (opcional)
-            fillRect(bx - 1, by - 1, 1, 1, blend);
-            fillRect(bx + size, by - 1, 1, 1, blend);
-            fillRect(bx - 1, by + size, 1, 1, blend);
-            fillRect(bx + size, by + size, 1, 1, blend);
-          }
-        }
-      } else if (bgColor != textColor) {
-        // Fondo del carácter
-        if (size == 1) {
-          drawPixel(x + col, y + row, bgColor);
-        } else {
-          fillRect(x + col * size, y + row * size, size, size, bgColor);
+  int cellWidth = 6 * size;
+  uint16_t* cell = glyphCache.insert(c, textColor.raw, bgColor.raw, size, (uint32_t)cellWidth * 8 * size);
+  if (!cell) return;
+
+  struct {
+    TextRun run;
+    char c;
+  } one = {{textColor, bgColor, size, 1, nullptr}, (char)c};
+  for (int row = 0; row < 8 * size; row++) {
+    textRowGenerator(&one, row, 0, cellWidth, cell + row * cellWidth);
+  }
+}
+
+/**
+ * Dibuja `len` caracteres. Con fondo, la cadena entera (separaciones incluidas)
+ * es un único bloque de filas generadas. Sin fondo (bgColor == textColor) se
+ * rellenan sólo los tramos horizontales encendidos de cada fila del glifo.
+ */
+void ST7789_Graphics::blitText(int x, int y, const char* text, int len, PanelColor textColor, PanelColor bgColor, uint8_t size) {
+  if (len <= 0 || size == 0) return;
+
+  if (bgColor == textColor) {
+    for (int i = 0; i < len; i++) {
+      uint8_t c = (uint8_t)text[i];
+      if (c > 127) continue;
+      int cx = x + i * 6 * size;
+      for (int row = 0; row < 8; row++) {
+        uint8_t line = font5x8[c][row];
+        int col = 0;
+        while (col < 5) {
+          if (!(line & (0x10 >> col))) { col++; continue; }
+          int start = col;
+          while (col < 5 && (line & (0x10 >> col))) col++;
+          rasterFill(cx + start * size, y + row * size, (col - start) * size, size, textColor);
         }
       }
     }
+    return;
+  }
+
+  struct {
+    TextRun run;
+    char chars[TEXT_RUN_MAX];
+  } block = {};  // Sin bytes de relleno indeterminados: el bloque se copia y se resume
+
+  bool cached = glyphCache.isEnabled() && size >= 2;
+  if (cached) {
+    for (int i = 0; i < len; i++) cacheGlyph(text[i], textColor, bgColor, size);
+  }
+
+  while (len > 0) {
+    int n = (len > TEXT_RUN_MAX) ? TEXT_RUN_MAX : len;
+    block.run.textColor = textColor;
+    block.run.bgColor = bgColor;
+    block.run.size = size;
+    block.run.len = n;
+    block.run.cache = cached ? &glyphCache : nullptr;
+    memcpy(block.chars, text, n);
+
+    // Sin la separación tras el último carácter
+    int width = n * 6 * size - size;
+    rasterRows(x, y, width, 8 * size, textRowGenerator, &block, sizeof(TextRun) + n);
+
+    x += n * 6 * size;
+    text += n;
+    len -= n;
   }
 }
 
-void ST7789_Graphics::drawText(int x, int y, const String& text, uint16_t textColor, uint16_t bgColor, uint8_t size) {
-  drawText(x, y, text.c_str(), textColor, bgColor, size);
+// ---------------------------------------------------------------------------
+// Fuentes proporcionales con suavizado
+// ---------------------------------------------------------------------------
+
+/** Nivel de cobertura del píxel `index` de un glifo empaquetado. */
+static inline uint8_t glyphLevel(const uint8_t* bits, uint32_t index, uint8_t bpp) {
+  uint32_t bit = index * bpp;
+  return (bits[bit >> 3] >> (8 - bpp - (bit & 7))) & ((1 << bpp) - 1);
 }
 
-void ST7789_Graphics::drawText(int x, int y, const char* text, uint16_t textColor, uint16_t bgColor, uint8_t size) {
-  if (!initialized || !text) return;
+/** Cadena preparada para fontRowGenerator; los caracteres van a continuación. */
+struct FontTextRun {
+  const AAFont* font;
+  uint16_t ramp[16];   // Nivel de cobertura -> color ya mezclado con el fondo
+  int16_t baseline;    // Fila de la línea base dentro del bloque
+  uint8_t len;
+};
 
-  int currentX = x;
-  int charWidth = getCharWidth(size);
+const AAGlyph* ST7789_Graphics::fontGlyph(uint8_t c) {
+  if (!currentFont || c < currentFont->first || c > currentFont->last) return nullptr;
+  return &currentFont->glyphs[c - currentFont->first];
+}
 
+int ST7789_Graphics::fontTextWidth(const char* text) {
+  int width = 0;
   for (int i = 0; text[i] != '\0'; i++) {
-    if (currentX + charWidth > SCREEN_WIDTH) break;
+    const AAGlyph* g = fontGlyph(text[i]);
+    if (g) width += g->xAdvance;
+  }
+  return width;
+}
+
+void ST7789_Graphics::fontRowGenerator(const void* ctx, int row, int x0, int x1, uint16_t* dst) {
+  const FontTextRun* run = (const FontTextRun*)ctx;
+  const char* chars = (const char*)(run + 1);
+  const AAFont* font = run->font;
+
+  for (int i = x0; i < x1; i++) dst[i - x0] = run->ramp[0];
+
+  int pen = 0;
+  for (int i = 0; i < run->len; i++) {
+    uint8_t c = chars[i];
+    if (c < font->first || c > font->last) continue;
+    const AAGlyph& g = font->glyphs[c - font->first];
 
-    drawChar(currentX, y, text[i], textColor, bgColor, size);
-    currentX += charWidth;
+    int gy = row - (run->baseline + g.yOffset);
+    int gx0 = pen + g.xOffset;
+    pen += g.xAdvance;
+    if (gy < 0 || gy >= g.height) continue;
+
+    int a = max(gx0, x0), b = min(gx0 + (int)g.width, x1);
+    if (a >= b) continue;
+
+    const uint8_t* bits = font->bitmap + g.offset;
+    uint32_t index = (uint32_t)gy * g.width + (a - gx0);
+    for (int x = a; x < b; x++, index++) {
+      uint8_t level = glyphLevel(bits, index, font->bpp);
+      if (level) dst[x - x0] = run->ramp[level];
+    }
   }
 }
 
-void ST7789_Graphics::drawAlignedText(int y, const String& text, uint8_t alignment, uint16_t textColor, uint16_t bgColor, uint8_t size) {
-  int x = 0;
+/**
+ * Dibuja una cadena con la fuente actual. Con fondo es un único bloque de
+ * filas generadas; sin fondo (bgColor == textColor) no hay con qué mezclar
+ * y se rellenan los tramos con cobertura de al menos la mitad.
+ */
+void ST7789_Graphics::blitFontText(int x, int y, const char* text, PanelColor textColor, PanelColor bgColor) {
+  const AAFont* font = currentFont;
+  int levels = 1 << font->bpp;
+
+  struct {
+    FontTextRun run;
+    char chars[TEXT_RUN_MAX];
+  } block = {};
+
+  int len = 0;
+  int width = 0, pen = 0;
+  while (text[len] != '\0' && len < TEXT_RUN_MAX) {
+    const AAGlyph* g = fontGlyph(text[len]);
+    if (g) {
+      width = max(width, pen + g->xOffset + (int)g->width);
+      pen += g->xAdvance;
+    }
+    block.chars[len] = text[len];
+    len++;
+  }
+  width = max(width, pen);
+  if (len == 0 || width <= 0) return;
+
+  if (bgColor == textColor) {
+    pen = 0;
+    for (int i = 0; i < len; i++) {
+      const AAGlyph* g = fontGlyph(block.chars[i]);
+      if (!g) continue;
+      const uint8_t* bits = font->bitmap + g->offset;
+      for (int row = 0; row < g->height; row++) {
+        int col = 0;
+        while (col < g->width) {
+          if (glyphLevel(bits, row * g->width + col, font->bpp) < levels / 2) { col++; continue; }
+          int start = col;
+          while (col < g->width && glyphLevel(bits, row * g->width + col, font->bpp) >= levels / 2) col++;
+          rasterFill(x + pen + g->xOffset + start, y + font->ascent + g->yOffset + row, col - start, 1, textColor);
+        }
+      }
+      pen += g->xAdvance;
+    }
+    return;
+  }
+
+  block.run.font = font;
+  block.run.baseline = font->ascent;
+  block.run.len = len;
+  for (int i = 0; i < levels; i++) {
+    if (textAAEnabled) {
+      uint16_t c = rgb565Blend(bgColor.rgb565(), textColor.rgb565(), i * 255 / (levels - 1));
+      block.run.ramp[i] = PanelColor::fromRGB565(c).raw;
+    } else {
+      block.run.ramp[i] = (i >= levels / 2) ? textColor.raw : bgColor.raw;
+    }
+  }
+
+  rasterRows(x, y, width, font->yAdvance, fontRowGenerator, &block, sizeof(FontTextRun) + len);
+}
+
+void ST7789_Graphics::drawAlignedText(int y, const String& text, uint8_t alignment, PanelColor textColor, PanelColor bgColor, uint8_t size) {
+  drawAlignedText(y, text.c_str(), alignment, textColor, bgColor, size);
+}
+
+void ST7789_Graphics::drawAlignedText(int y, const char* text, uint8_t alignment, PanelColor textColor, PanelColor bgColor, uint8_t size) {
+  GfxRect box = getClip();
+  int x = box.x;
   int textWidth = getTextWidth(text, size);
 
   switch (alignment) {
     case ALIGN_LEFT:
-      x = 0;
+      x = box.x;
       break;
     case ALIGN_CENTER:
-      x = (SCREEN_WIDTH - textWidth) / 2;
+      x = box.x + (box.w - textWidth) / 2;
       break;
     case ALIGN_RIGHT:
-      x = SCREEN_WIDTH - textWidth;
+      x = box.x + box.w - textWidth;
       break;
   }
 
   drawText(x, y, text, textColor, bgColor, size);
 }
 
-void ST7789_Graphics::drawCenteredText(int y, const String& text, uint16_t textColor, uint16_t bgColor, uint8_t size) {
+void ST7789_Graphics::drawCenteredText(int y, const String& text, PanelColor textColor, PanelColor bgColor, uint8_t size) {
+  drawAlignedText(y, text.c_str(), ALIGN_CENTER, textColor, bgColor, size);
+}
+
+void ST7789_Graphics::drawCenteredText(int y, const char* text, PanelColor textColor, PanelColor bgColor, uint8_t size) {
   drawAlignedText(y, text, ALIGN_CENTER, textColor, bgColor, size);
 }
 
@@ -399,20 +1629,27 @@ int ST7789_Graphics::getTextWidth(const String& text, uint8_t size) {
 
 int ST7789_Graphics::getTextWidth(const char* text, uint8_t size) {
   if (!text) return 0;
+  if (currentFont) return fontTextWidth(text);
   int len = strlen(text);
   return len * getCharWidth(size) - size;  // Quitar el último espacio
 }
 
 int ST7789_Graphics::getCharWidth(uint8_t size) {
+  // Con fuente proporcional: avance de una cifra, útil para maquetar números
+  if (currentFont) {
+    const AAGlyph* g = fontGlyph('0');
+    return g ? g->xAdvance : 0;
+  }
   return 5 * size + size;  // 5 pixels + 1 de espacio
 }
 
 int ST7789_Graphics::getCharHeight(uint8_t size) {
+  if (currentFont) return currentFont->yAdvance;
   return 8 * size;
 }
 
 void ST7789_Graphics::drawProgressBar(int x, int y, int width, int height, int progress, int maxProgress,
-                                      uint16_t fillColor, uint16_t bgColor, uint16_t borderColor) {
+                                      PanelColor fillColor, PanelColor bgColor, PanelColor borderColor) {
   if (!initialized) return;
 
   // Dibujar borde
@@ -433,13 +1670,13 @@ void ST7789_Graphics::drawProgressBar(int x, int y, int width, int height, int p
   }
 }
 
-void ST7789_Graphics::drawTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color) {
+void ST7789_Graphics::drawTriangle(int x0, int y0, int x1, int y1, int x2, int y2, PanelColor color) {
   drawLine(x0, y0, x1, y1, color);
   drawLine(x1, y1, x2, y2, color);
   drawLine(x2, y2, x0, y0, color);
 }
 
-void ST7789_Graphics::clearCenteredLine(int y, uint8_t size, uint16_t bgColor) {
+void ST7789_Graphics::clearCenteredLine(int y, uint8_t size, PanelColor bgColor) {
   if (!initialized) return;
   int h = getCharHeight(size);
   int padding = 6;
@@ -449,52 +1686,88 @@ void ST7789_Graphics::clearCenteredLine(int y, uint8_t size, uint16_t bgColor) {
   fillRect(0, top, SCREEN_WIDTH, height, bgColor);
 }
 
-void ST7789_Graphics::drawRoundRect(int x, int y, int width, int height, int radius, uint16_t color) {
-  // Líneas principales
-  drawHLine(x + radius, y, width - 2 * radius, color);               // Top
-  drawHLine(x + radius, y + height - 1, width - 2 * radius, color);  // Bottom
-  drawVLine(x, y + radius, height - 2 * radius, color);              // Left
-  drawVLine(x + width - 1, y + radius, height - 2 * radius, color);  // Right
+void ST7789_Graphics::drawRoundRect(int x, int y, int width, int height, int radius, PanelColor color) {
+  if (!initialized) return;
+  rasterShape(roundRectShape(x, y, width, height, radius, true), color);
+}
 
-  // Esquinas
-  drawCircleHelper(x + radius, y + radius, radius, 1, color);
-  drawCircleHelper(x + width - radius - 1, y + radius, radius, 2, color);
-  drawCircleHelper(x + width - radius - 1, y + height - radius - 1, radius, 4, color);
-  drawCircleHelper(x + radius, y + height - radius - 1, radius, 8, color);
+void ST7789_Graphics::getRGB(PanelColor color, uint8_t& r, uint8_t& g, uint8_t& b) {
+  uint16_t c = color.rgb565();
+  r = (c >> 8) & 0xF8;
+  g = (c >> 3) & 0xFC;
+  b = (c << 3) & 0xF8;
 }
 
-uint16_t ST7789_Graphics::color565(uint8_t r, uint8_t g, uint8_t b) {
-  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+PanelColor ST7789_Graphics::interpolateColor(PanelColor color1, PanelColor color2, float ratio) {
+  if (ratio <= 0) return color1;
+  if (ratio >= 1) return color2;
+  return PanelColor::fromRGB565(rgb565Blend(color1.rgb565(), color2.rgb565(), (uint8_t)(ratio * 255.0f + 0.5f)));
 }
 
-void ST7789_Graphics::getRGB(uint16_t color, uint8_t& r, uint8_t& g, uint8_t& b) {
-  r = (color >> 8) & 0xF8;
-  g = (color >> 3) & 0xFC;
-  b = (color << 3) & 0xF8;
+bool ST7789_Graphics::fillRectAlpha(int x, int y, int width, int height, PanelColor color, uint8_t alpha) {
+  if (!initialized) return false;
+  if (alpha == 255) {
+    fillRect(x, y, width, height, color);
+    return true;
+  }
+  return compositeRect(x, y, width, height, color, nullptr, width, alpha);
 }
 
-uint16_t ST7789_Graphics::interpolateColor(uint16_t color1, uint16_t color2, float ratio) {
-  if (ratio <= 0) return color1;
-  if (ratio >= 1) return color2;
+bool ST7789_Graphics::drawAlphaMask(int x, int y, int width, int height, const uint8_t* mask, PanelColor color) {
+  if (!initialized || !mask) return false;
+  return compositeRect(x, y, width, height, color, mask, width, 0);
+}
 
-  uint8_t r1, g1, b1, r2, g2, b2;
-  getRGB(color1, r1, g1, b1);
-  getRGB(color2, r2, g2, b2);
+/**
+ * Mezcla un color sobre el contenido del framebuffer, con alpha constante o
+ * con una máscara (mask != nullptr, `stride` bytes por fila). Sin framebuffer
+ * no hay de dónde leer el fondo y devuelve false.
+ */
+bool ST7789_Graphics::compositeRect(int x, int y, int w, int h, PanelColor color, const uint8_t* mask, int stride, uint8_t alpha) {
+  if (!framebuffer && !indexedBuffer) return false;
+
+  int ox = x + clipState.originX, oy = y + clipState.originY;
+  if (!clipToScreen(x, y, w, h)) return true;
+  if (mask) mask += (y - oy) * stride + (x - ox);
+
+  // La mezcla opera en RGB565 nativo: la fila se pasa a scratch con los
+  // bytes intercambiados y vuelve al orden del panel al guardarla.
+  uint16_t native = color.rgb565();
+  uint16_t scratch[SCREEN_WIDTH];
+  for (int row = 0; row < h; row++) {
+    uint16_t* fbRow = framebuffer ? framebuffer + (y + row) * SCREEN_WIDTH + x : nullptr;
+    if (framebuffer) {
+      rgb565SwapPixels(scratch, fbRow, w);
+    } else {
+      // Expandir la fila indexada, mezclar y volver a la paleta más cercana
+      const uint8_t* line = indexedBuffer + (y + row) * (SCREEN_WIDTH / 2);
+      for (int i = 0; i < w; i++) {
+        int px = x + i;
+        scratch[i] = palette[(px & 1) ? (line[px / 2] >> 4) : (line[px / 2] & 0x0F)].rgb565();
+      }
+    }
 
-  uint8_t r = r1 + (r2 - r1) * ratio;
-  uint8_t g = g1 + (g2 - g1) * ratio;
-  uint8_t b = b1 + (b2 - b1) * ratio;
+    if (mask) rgb565BlendSpanMask(scratch, native, mask + row * stride, w);
+    else rgb565BlendSpanColor(scratch, native, w, alpha);
 
-  return color565(r, g, b);
+    if (framebuffer) {
+      rgb565SwapPixels(fbRow, scratch, w);
+    } else {
+      rgb565SwapPixels(scratch, scratch, w);
+      storeIndexed(x, y + row, w, scratch);
+    }
+  }
+  markDirty(x, y, w, h);
+  return true;
 }
 
-void ST7789_Graphics::fadeScreen(uint16_t toColor, int steps, int delayMs) {
+void ST7789_Graphics::fadeScreen(PanelColor toColor, int steps, int delayMs) {
   // Simplificado - llenar con color destino
   clearScreen(toColor);
   delay(delayMs * steps / 10);  // Simular fade
 }
 
-void ST7789_Graphics::scrollText(int y, const String& text, uint16_t textColor, uint16_t bgColor, uint8_t size, int speed) {
+void ST7789_Graphics::scrollText(int y, const String& text, PanelColor textColor, PanelColor bgColor, uint8_t size, int speed) {
   int textWidth = getTextWidth(text, size);
   int charHeight = getCharHeight(size);
 
@@ -505,73 +1778,59 @@ void ST7789_Graphics::scrollText(int y, const String& text, uint16_t textColor,
   }
 }
 
-// Funciones auxiliares privadas
-void ST7789_Graphics::drawCircleHelper(int x0, int y0, int r, uint8_t cornername, uint16_t color) {
-  int f = 1 - r;
-  int ddF_x = 1;
-  int ddF_y = -2 * r;
-  int x = 0;
-  int y = r;
+bool ST7789_Graphics::setScrollArea(int start, int length) {
+  if (!initialized) return false;
+  if (start < 0 || length <= 0) return false;
+  uint16_t a = LCD_LogicalToScanLine(start);
+  uint16_t b = LCD_LogicalToScanLine(start + length - 1);
+  uint16_t top = (a < b) ? a : b;
+  if (top + length > LCD_SCAN_LINES) return false;
+
+  scrollStart = start;
+  scrollLength = length;
+  scrollTopLine = top;
+  scrollLines = 0;
+  LCD_SetScrollArea(top, length, LCD_SCAN_LINES - top - length);
+  LCD_SetScrollStart(top);
+  tilesStale = true;
+  return true;
+}
 
-  while (x < y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
+void ST7789_Graphics::resetScroll() {
+  if (!initialized) return;
+  scrollLength = 0;
+  scrollLines = 0;
+  LCD_SetScrollArea(0, LCD_SCAN_LINES, 0);
+  LCD_SetScrollStart(0);
+  tilesStale = true;
+}
 
-    if (cornername & 0x4) {
-      drawPixel(x0 + x, y0 + y, color);
-      drawPixel(x0 + y, y0 + x, color);
-    }
-    if (cornername & 0x2) {
-      drawPixel(x0 + x, y0 - y, color);
-      drawPixel(x0 + y, y0 - x, color);
-    }
-    if (cornername & 0x8) {
-      drawPixel(x0 - y, y0 + x, color);
-      drawPixel(x0 - x, y0 + y, color);
-    }
-    if (cornername & 0x1) {
-      drawPixel(x0 - y, y0 - x, color);
-      drawPixel(x0 - x, y0 - y, color);
-    }
-  }
+int ST7789_Graphics::scrollMap(int pos) {
+  if (scrollLength == 0 || pos < scrollStart || pos >= scrollStart + scrollLength) return pos;
+  uint16_t line = LCD_LogicalToScanLine(pos);
+  uint16_t mem = scrollTopLine + (line - scrollTopLine + scrollLines) % scrollLength;
+  return LCD_ScanLineToLogical(mem);
 }
 
-void ST7789_Graphics::fillCircleHelper(int x0, int y0, int r, uint8_t cornername, int delta, uint16_t color) {
-  int f = 1 - r;
-  int ddF_x = 1;
-  int ddF_y = -2 * r;
-  int x = 0;
-  int y = r;
+int ST7789_Graphics::scrollBy(int pixels, PanelColor fillColor) {
+  if (!initialized || scrollLength == 0) return 0;
+  if (pixels <= 0 || pixels >= scrollLength) return scrollMap(scrollStart);
 
-  while (x < y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
+  // Con el espejo MY las líneas de barrido avanzan al revés que la coordenada lógica
+  bool mirrored = LCD_LogicalToScanLine(1) < LCD_LogicalToScanLine(0);
+  int step = mirrored ? scrollLength - pixels : pixels;
+  scrollLines = (scrollLines + step) % scrollLength;
+  LCD_SetScrollStart(scrollTopLine + scrollLines);
+  tilesStale = true;
 
-    if (cornername & 0x1) {
-      drawVLine(x0 + x, y0 - y, 2 * y + 1 + delta, color);
-      drawVLine(x0 + y, y0 - x, 2 * x + 1 + delta, color);
-    }
-    if (cornername & 0x2) {
-      drawVLine(x0 - x, y0 - y, 2 * y + 1 + delta, color);
-      drawVLine(x0 - y, y0 - x, 2 * x + 1 + delta, color);
-    }
-  }
+  int exposed = scrollStart + scrollLength - pixels;
+  fillScrollStrip(exposed, pixels, fillColor);
+  return scrollMap(exposed);
 }
 
-void ST7789_Graphics::fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color) {
-  int a, b, y, last;
+// Funciones auxiliares privadas
+void ST7789_Graphics::fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, PanelColor color) {
+  if (!initialized) return;
 
   // Ordenar coordenadas por Y
   if (y0 > y1) {
@@ -587,67 +1846,181 @@ void ST7789_Graphics::fillTriangle(int x0, int y0, int x1, int y1, int x2, int y
     swap(x0, x1);
   }
 
-  if (y0 == y2) {  // Handle awkward all-on-same-line case
-    a = b = x0;
-    if (x1 < a) a = x1;
-    else if (x1 > b) b = x1;
-    if (x2 < a) a = x2;
-    else if (x2 > b) b = x2;
-    drawHLine(a, y0, b - a + 1, color);
-    return;
-  }
+  GfxShape shape = {};
+  shape.kind = GFX_SHAPE_TRIANGLE;
+  shape.tx[0] = x0; shape.ty[0] = y0;
+  shape.tx[1] = x1; shape.ty[1] = y1;
+  shape.tx[2] = x2; shape.ty[2] = y2;
+  shape.x = min(x0, min(x1, x2));
+  shape.y = y0;
+  shape.w = max(x0, max(x1, x2)) - shape.x + 1;
+  shape.h = y2 - y0 + 1;
+  rasterShape(shape, color);
+}
 
-  int dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
-      dx12 = x2 - x1, dy12 = y2 - y1;
-  int sa = 0, sb = 0;
+void ST7789_Graphics::fillRoundRect(int x, int y, int width, int height, int radius, PanelColor color) {
+  if (!initialized) return;
+  rasterShape(roundRectShape(x, y, width, height, radius, false), color);
+}
 
-  if (y1 == y2) last = y1;
-  else last = y1 - 1;
+// ---------------------------------------------------------------------------
+// Imágenes
+// ---------------------------------------------------------------------------
+
+/** Recorte de imagen preparado para imageRowGenerator. */
+struct ImageRun {
+  const void* data;
+  int16_t width;       // Ancho de la imagen completa (paso entre filas)
+  int16_t sx, sy;      // Píxel de la imagen en el origen del bloque
+  uint8_t format;
+  uint16_t lut[16];    // Paleta copiada, en orden del panel
+};
 
-  for (y = y0; y <= last; y++) {
-    a = x0 + sa / dy01;
-    b = x0 + sb / dy02;
-    sa += dx01;
-    sb += dx02;
-    if (a > b) swap(a, b);
-    drawHLine(a, y, b - a + 1, color);
+/**
+ * Decodifica las columnas [skip, skip + n) de una fila RLE565. Las rachas
+ * anteriores a `skip` se saltan sin expandirlas.
+ */
+static void rleDecodeRow(const uint8_t* data, int y, int skip, int n, uint16_t* dst) {
+  const uint8_t* o = data + 4 * y;
+  const uint8_t* p = data + (o[0] | (o[1] << 8) | (o[2] << 16) | ((uint32_t)o[3] << 24));
+  while (n > 0) {
+    uint8_t token = *p++;
+    bool repeat = token & 0x80;
+    int count = (token & 0x7F) + 1;
+    if (skip >= count) {
+      skip -= count;
+      p += repeat ? 2 : 2 * count;
+      continue;
+    }
+    int take = min(count - skip, n);
+    if (repeat) {
+      uint16_t c;
+      memcpy(&c, p, sizeof(c));
+      for (int i = 0; i < take; i++) dst[i] = c;
+      p += 2;
+    } else {
+      memcpy(dst, p + 2 * skip, take * sizeof(uint16_t));
+      p += 2 * count;
+    }
+    dst += take;
+    n -= take;
+    skip = 0;
   }
+}
 
-  sa = dx12 * (y - y1);
-  sb = dx02 * (y - y0);
-  for (; y <= y2; y++) {
-    a = x1 + sa / dy12;
-    b = x0 + sb / dy02;
-    sa += dx12;
-    sb += dx02;
-    if (a > b) swap(a, b);
-    drawHLine(a, y, b - a + 1, color);
+static void imageRowGenerator(const void* ctx, int row, int x0, int x1, uint16_t* dst) {
+  const ImageRun* run = (const ImageRun*)ctx;
+  uint32_t index = (uint32_t)(run->sy + row) * run->width + run->sx + x0;
+  int n = x1 - x0;
+  if (run->format == GFX_BITMAP_RLE565) {
+    rleDecodeRow((const uint8_t*)run->data, run->sy + row, run->sx + x0, n, dst);
+    return;
   }
+  if (run->format == GFX_BITMAP_RGB565) {
+    rgb565SwapPixels(dst, (const uint16_t*)run->data + index, n);
+    return;
+  }
+  const uint8_t* bits = (const uint8_t*)run->data;
+  uint8_t bpp = (run->format == GFX_BITMAP_1BPP) ? 1 : 4;
+  for (int i = 0; i < n; i++) dst[i] = run->lut[glyphLevel(bits, index + i, bpp)];
 }
 
-void ST7789_Graphics::fillRoundRect(int x, int y, int width, int height, int radius, uint16_t color) {
-  fillRect(x + radius, y, width - 2 * radius, height, color);
-  fillCircleHelper(x + width - radius - 1, y + radius, radius, 1, height - 2 * radius - 1, color);
-  fillCircleHelper(x + radius, y + radius, radius, 2, height - 2 * radius - 1, color);
+/** Valor del píxel `index` tal como se compara con GfxBitmap::key. */
+static inline int32_t imageSample(const GfxBitmap& bmp, uint32_t index) {
+  if (bmp.format == GFX_BITMAP_RGB565) return ((const uint16_t*)bmp.data)[index];
+  return glyphLevel((const uint8_t*)bmp.data, index, bmp.format == GFX_BITMAP_1BPP ? 1 : 4);
 }
 
-void ST7789_Graphics::drawBitmap(int x, int y, const uint8_t* bitmap, int width, int height, uint16_t color, uint16_t bgColor) {
-  if (!initialized || !bitmap) return;
-
-  for (int j = 0; j < height; j++) {
-    for (int i = 0; i < width; i++) {
-      int byteIndex = (j * width + i) / 8;
-      int bitIndex = (j * width + i) % 8;
+void ST7789_Graphics::drawImage(int x, int y, const GfxBitmap& bitmap, const GfxRect* clip) {
+  if (!initialized || !bitmap.data) return;
+
+  // Parte visible: imagen ∩ recorte actual ∩ clip (coordenadas locales)
+  GfxRect box = getClip();
+  int x0 = max(x, (int)box.x), y0 = max(y, (int)box.y);
+  int x1 = min(x + (int)bitmap.width, box.x + box.w), y1 = min(y + (int)bitmap.height, box.y + box.h);
+  if (clip) {
+    x0 = max(x0, (int)clip->x);
+    y0 = max(y0, (int)clip->y);
+    x1 = min(x1, clip->x + clip->w);
+    y1 = min(y1, clip->y + clip->h);
+  }
+  if (x0 >= x1 || y0 >= y1) return;
+
+  ImageRun run = {};
+  run.data = bitmap.data;
+  run.width = bitmap.width;
+  run.sx = x0 - x;
+  run.sy = y0 - y;
+  run.format = bitmap.format;
+  int entries = (bitmap.format == GFX_BITMAP_1BPP) ? 2 : (bitmap.format == GFX_BITMAP_4BPP) ? 16 : 0;
+  for (int i = 0; i < entries; i++) run.lut[i] = bitmap.palette ? bitmap.palette[i].raw : BLACK.raw;
+
+  if (bitmap.key == GFX_NO_KEY) {
+    rasterRows(x0, y0, x1 - x0, y1 - y0, imageRowGenerator, &run, sizeof(run));
+    return;
+  }
 
-      if (bitmap[byteIndex] & (0x80 >> bitIndex)) {
-        drawPixel(x + i, y + j, color);
-      } else if (bgColor != color) {
-        drawPixel(x + i, y + j, bgColor);
+  // Color transparente: un tramo por racha de píxeles visibles
+  bool rle = (bitmap.format == GFX_BITMAP_RLE565);
+  uint16_t keyRaw = rgb565ByteSwap((uint16_t)bitmap.key);
+  uint16_t decoded[SCREEN_WIDTH];
+  for (int py = y0; py < y1; py++) {
+    uint32_t rowIndex = (uint32_t)(py - y) * bitmap.width;
+    // RLE no admite acceso por píxel: se decodifica la fila visible una vez
+    if (rle) rleDecodeRow((const uint8_t*)bitmap.data, py - y, x0 - x, x1 - x0, decoded);
+    auto opaque = [&](int px) {
+      return rle ? decoded[px - x0] != keyRaw : imageSample(bitmap, rowIndex + (px - x)) != bitmap.key;
+    };
+    int px = x0;
+    while (px < x1) {
+      if (!opaque(px)) { px++; continue; }
+      int start = px;
+      while (px < x1 && opaque(px)) px++;
+      if (rle) {
+        rasterPixels(start, py, px - start, 1, decoded + (start - x0));
+      } else if (bitmap.format == GFX_BITMAP_1BPP) {
+        // Con uno de los dos índices transparente la racha es de un solo color
+        rasterFill(start, py, px - start, 1, PanelColor{run.lut[bitmap.key ? 0 : 1]});
+      } else {
+        run.sx = start - x;
+        run.sy = py - y;
+        rasterRows(start, py, px - start, 1, imageRowGenerator, &run, sizeof(run));
       }
     }
   }
 }
 
+void ST7789_Graphics::drawImageRegion(int x, int y, const GfxBitmap& bitmap, const GfxRect& src) {
+  // La región es la imagen desplazada para que src caiga en x,y, recortada a src
+  GfxRect clip = {(int16_t)x, (int16_t)y, src.w, src.h};
+  drawImage(x - src.x, y - src.y, bitmap, &clip);
+}
+
+void ST7789_Graphics::drawBitmap(int x, int y, const uint8_t* bitmap, int width, int height, PanelColor color, PanelColor bgColor) {
+  if (!bitmap) return;
+  PanelColor palette[2] = {bgColor, color};
+  GfxBitmap bmp = {bitmap, palette, (int16_t)width, (int16_t)height, GFX_BITMAP_1BPP,
+                   (bgColor == color) ? 0 : GFX_NO_KEY};
+  drawImage(x, y, bmp);
+}
+
+// Rellena una franja visible del área de scroll; se parte en dos si cruza el borde de la memoria
+void ST7789_Graphics::fillScrollStrip(int from, int count, PanelColor color) {
+  while (count > 0) {
+    int start = scrollMap(from);
+    int run = 1;
+    while (run < count && scrollMap(from + run) == start + run) run++;
+    // scrollMap() da coordenadas de pantalla; descontar el origen actual
+    if (CurrentOrientation == HORIZONTAL) {
+      fillRect(start - clipState.originX, -clipState.originY, run, SCREEN_HEIGHT, color);
+    } else {
+      fillRect(-clipState.originX, start - clipState.originY, SCREEN_WIDTH, run, color);
+    }
+    from += run;
+    count -= run;
+  }
+}
+
 void ST7789_Graphics::swap(int& a, int& b) {
   int temp = a;
   a = b;
@@ -3,6 +3,10 @@
 
 #include <Arduino.h>
 #include "Display_ST7789.h"
+#include "PanelColor.h"
+#include "GlyphCache.h"
+#include "AAFont.h"
+#include "RGB565Blend.h"
 
 /**
  * @file ST7789_Graphics.h
@@ -16,22 +20,107 @@
 // Configuración de la pantalla (proveniente de Display_Config.h)
 #include "Display_Config.h"
 
-// Colores básicos RGB565
-#define BLACK   0x0000
-#define WHITE   0xFFFF
-#define RED     0xF800
-#define GREEN   0x07E0
-#define BLUE    0x001F
-#define YELLOW  0xFFE0
-#define CYAN    0x07FF
-#define MAGENTA 0xF81F
-#define ORANGE  0xFD20
-#define PINK    0xFC18
-#define PURPLE  0x8010
-#define BROWN   0xA145
-#define GRAY    0x8410
-#define LIGHTGRAY 0xC618
-#define DARKGRAY  0x4208
+// Colores básicos, convertidos al orden del panel en compilación (ver PanelColor.h)
+#define BLACK     PanelColor::fromRGB565(0x0000)
+#define WHITE     PanelColor::fromRGB565(0xFFFF)
+#define RED       PanelColor::fromRGB565(0xF800)
+#define GREEN     PanelColor::fromRGB565(0x07E0)
+#define BLUE      PanelColor::fromRGB565(0x001F)
+#define YELLOW    PanelColor::fromRGB565(0xFFE0)
+#define CYAN      PanelColor::fromRGB565(0x07FF)
+#define MAGENTA   PanelColor::fromRGB565(0xF81F)
+#define ORANGE    PanelColor::fromRGB565(0xFD20)
+#define PINK      PanelColor::fromRGB565(0xFC18)
+#define PURPLE    PanelColor::fromRGB565(0x8010)
+#define BROWN     PanelColor::fromRGB565(0xA145)
+#define GRAY      PanelColor::fromRGB565(0x8410)
+#define LIGHTGRAY PanelColor::fromRGB565(0xC618)
+#define DARKGRAY  PanelColor::fromRGB565(0x4208)
+#define NAVY      PanelColor::fromRGB565(0x000F)
+
+/** Rectángulo en coordenadas de pantalla. */
+struct GfxRect {
+    int16_t x, y, w, h;
+};
+
+/** Máximo de rectángulos sucios que se siguen antes de fusionar a la fuerza. */
+#define MAX_DIRTY_RECTS 8
+
+/** Niveles de la pila de recorte (pushClip / pushViewport). */
+#define CLIP_STACK_DEPTH 8
+
+/** Entradas de la paleta del framebuffer indexado (4 bits por píxel). */
+#define PALETTE_SIZE 16
+
+// Renderizado por franjas (sin framebuffer)
+/** Operaciones que caben en la lista de dibujo antes de renderizar a la fuerza. */
+#define DL_MAX_OPS 128
+/** Bytes para datos de las operaciones (píxeles copiados, textos). */
+#define DL_ARENA_BYTES 2048
+/** Filas que se rasterizan juntas; acota la lista de operaciones activas. */
+#define BAND_HEIGHT 16
+/** Ancho de las baldosas que compara enableFrameDiff() (su alto es BAND_HEIGHT). */
+#define DIFF_TILE_WIDTH 32
+#define DIFF_TILE_COLS ((SCREEN_WIDTH + DIFF_TILE_WIDTH - 1) / DIFF_TILE_WIDTH)
+#define DIFF_TILE_ROWS ((SCREEN_HEIGHT + BAND_HEIGHT - 1) / BAND_HEIGHT)
+
+/** Tipos de operación de la lista de dibujo. */
+enum GfxOpType : uint8_t {
+    GFX_OP_FILL,      // Rectángulo de color sólido
+    GFX_OP_PIXELS,    // Bloque de píxeles (orden del panel) copiado en la arena
+    GFX_OP_ROWS,      // Generador de filas (texto, imágenes) con su contexto en la arena
+    GFX_OP_SHAPE      // Figura por tramos (GfxShape + tabla de esquinas en la arena)
+};
+
+struct GfxShape;
+
+/**
+ * Generador de filas para la capa de rasterizado: escribe en dst los colores
+ * (en orden del panel) de la fila `row` entre las columnas [x0, x1), relativas
+ * al origen del bloque.
+ */
+typedef void (*GfxRowGenerator)(const void* ctx, int row, int x0, int x1, uint16_t* dst);
+
+/** Operación grabada en la lista de dibujo (ya recortada a pantalla). */
+struct GfxOp {
+    uint8_t type;
+    PanelColor color;
+    int16_t x, y, w, h;
+    uint16_t data;    // Desplazamiento en bytes dentro de la arena
+};
+
+/** Formatos de origen de drawImage(). */
+enum GfxBitmapFormat : uint8_t {
+    GFX_BITMAP_1BPP,    // 1 bit por píxel: palette[0] fondo, palette[1] tinta
+    GFX_BITMAP_4BPP,    // Índices de 4 bits sobre una paleta de 16 colores
+    GFX_BITMAP_RGB565,  // uint16_t RGB565 nativos, como los exportan los conversores
+    GFX_BITMAP_RLE565   // RGB565 comprimido por rachas (tools/img2rle.py)
+};
+
+/** Valor de GfxBitmap::key para imágenes sin color transparente. */
+#define GFX_NO_KEY -1
+
+/**
+ * Imagen para drawImage(). Los formatos de 1 y 4 bits van fila a fila con el
+ * bit más significativo primero y sin relleno entre filas (igual que AAFont).
+ *
+ * GFX_BITMAP_RLE565 empieza con una tabla de `height` desplazamientos de 32
+ * bits (little-endian, desde el inicio de los datos) al comienzo de cada fila,
+ * así que cualquier región se decodifica sin recorrer las filas anteriores.
+ * Cada fila es una secuencia de fichas: byte 0x00..0x7F = n+1 colores
+ * literales a continuación; 0x80..0xFF = un color repetido (n-0x7F) veces.
+ * Los colores van con el byte alto primero, que es el orden del panel: los
+ * literales se copian al buffer DMA tal cual.
+ * La paleta se copia al dibujar; los píxeles no: con beginFrame() deben
+ * seguir en memoria hasta endFrame() (lo normal en imágenes en flash).
+ */
+struct GfxBitmap {
+    const void* data;
+    const PanelColor* palette;  // 2 entradas (1 bpp) o 16 (4 bpp); sin uso en RGB565
+    int16_t width, height;
+    uint8_t format;             // GfxBitmapFormat
+    int32_t key;                // Índice (1/4 bpp) o RGB565 nativo que no se dibuja, o GFX_NO_KEY
+};
 
 // Alineación de texto
 #define ALIGN_LEFT    0
@@ -50,6 +139,7 @@
 class ST7789_Graphics {
 private:
     bool initialized;
+    bool initStarted;
     
     // Fuente bitmap 5x8 - ACTUALIZADA CON SOPORTE COMPLETO ASCII (0-127)
     static const uint8_t font5x8[128][8];
@@ -58,18 +148,40 @@ public:
     ST7789_Graphics();
 
     /**
-     * @brief Habilita/deshabilita suavizado ligero (anti-alias) para texto escalado.
+     * @brief Habilita/deshabilita el suavizado (anti-alias) del texto.
      *
-     * El suavizado que implementamos es una técnica ligera que dibuja píxeles
-     * intermedios en los bordes de los bloques escalados para reducir el efecto
-     * de dientes (aliasing) cuando se usa `size > 1` con la fuente bitmap.
+     * Afecta a las fuentes proporcionales (setFont): con suavizado los niveles
+     * de cobertura se mezclan con el fondo; sin él se umbralizan. La fuente
+     * bitmap 5x8 no tiene cobertura y siempre se dibuja nítida.
      * @param enable true para habilitar, false para deshabilitar (por defecto: false)
      */
     void enableTextAA(bool enable) { textAAEnabled = enable; }
+
+    /**
+     * @brief Selecciona una fuente proporcional (ver AAFont.h y tools/ttf2font.py).
+     *
+     * Con fuente, drawText/drawAlignedText/getTextWidth/getCharHeight la usan e
+     * ignoran `size`; `y` es la parte superior de la línea. Los bordes se mezclan
+     * con el fondo mediante una rampa de niveles precalculada por cadena, así
+     * que el texto suavizado cuesta lo mismo que el plano (una ventana). Con
+     * enableTextAA(false) la cobertura se umbraliza. nullptr vuelve a font5x8.
+     */
+    void setFont(const AAFont* font) { currentFont = font; }
+    /** @brief Fuente proporcional actual (nullptr: font5x8). */
+    const AAFont* getFont() { return currentFont; }
     
     // Inicialización
+    /**
+     * @brief Arranca el reset del panel y vuelve sin esperar.
+     *
+     * Las esperas que exige el ST7789 tras el reset transcurren mientras el
+     * llamador hace otras tareas (NVS, BLE); begin() completa el arranque.
+     */
+    void beginAsync();
     /**
      * @brief Inicializa el driver de la pantalla y ajusta el brillo.
+     *
+     * Si antes se llamó a beginAsync() sólo espera lo que falte de cada pausa.
      * @param brightness Valor 0..100 para la retroiluminación.
      * @return true si la inicialización fue exitosa.
      */
@@ -77,44 +189,153 @@ public:
     /** @brief Indica si la pantalla ya fue inicializada. */
     bool isReady();
     
+    // Framebuffer
+    /**
+     * @brief Activa/desactiva el framebuffer RGB565 completo (PSRAM si existe).
+     *
+     * Con framebuffer las primitivas dibujan en memoria y sólo registran
+     * rectángulos sucios; flush() envía las regiones fusionadas al panel.
+     * Al activarlo el contenido empieza en negro: conviene un clearScreen().
+     * @return false si no hay memoria para el framebuffer.
+     */
+    bool enableFramebuffer(bool enable);
+    /** @brief Indica si el framebuffer está activo. */
+    bool hasFramebuffer() { return framebuffer != nullptr; }
+    /**
+     * @brief Activa/desactiva el framebuffer indexado de 4 bits por píxel.
+     *
+     * Ocupa la cuarta parte que el RGB565 y se reserva en SRAM interna. Cada
+     * color dibujado se traduce a la entrada más cercana de la paleta; al hacer
+     * flush() las filas sucias se expanden a RGB565 con una tabla de 256 pares.
+     * Es excluyente con enableFramebuffer().
+     * @return false si no hay memoria para el framebuffer.
+     */
+    bool enableIndexedFramebuffer(bool enable);
+    /** @brief Indica si el framebuffer indexado está activo. */
+    bool hasIndexedFramebuffer() { return indexedBuffer != nullptr; }
+    /** @brief Envía al panel las regiones sucias del framebuffer (no-op sin framebuffer). */
+    void flush();
+
+    // Renderizado por franjas
+    /**
+     * @brief Empieza a grabar un cuadro.
+     *
+     * Sin framebuffer, las primitivas se graban en una lista de dibujo de
+     * pocos KB en lugar de enviarse. endFrame() la rasteriza de BAND_HEIGHT
+     * en BAND_HEIGHT filas directamente sobre el buffer DMA, así cada píxel
+     * tapado por varias primitivas viaja una sola vez por SPI. Sólo se envían
+     * los píxeles que alguna operación cubre.
+     * @return false si no hay memoria para la lista (se sigue dibujando directo).
+     */
+    bool beginFrame();
+    /** @brief Termina el cuadro: rasteriza la lista o, con framebuffer, hace flush(). */
+    void endFrame();
+    /**
+     * @brief Activa la comparación entre cuadros de la lista de dibujo.
+     *
+     * endFrame() resume las operaciones de cada baldosa de DIFF_TILE_WIDTH x
+     * BAND_HEIGHT (tipo, color, rectángulo y datos, en orden) y sólo rasteriza
+     * y envía las baldosas cuyo resumen cambió desde el cuadro anterior: repetir
+     * una pantalla idéntica cuesta CPU pero no SPI. Cada cuadro debe describir
+     * entera la zona que redibuja, fondo incluido. Las imágenes se comparan por
+     * puntero, no por contenido. Un dibujo directo (fuera de un cuadro) o un
+     * scroll obligan a enviar entero el cuadro siguiente. No afecta a los
+     * modos con framebuffer, que ya envían sólo lo sucio.
+     */
+    void enableFrameDiff(bool enable);
+    /** @brief Hace que el próximo cuadro se envíe entero (p. ej. tras escribir con LCD_*). */
+    void invalidateFrame() { tilesStale = true; }
+
+    // Paleta (framebuffer indexado)
+    /**
+     * @brief Cambia una entrada de la paleta.
+     *
+     * Con el framebuffer indexado activo toda la pantalla queda sucia: el
+     * siguiente flush() vuelve a pintar con los colores nuevos sin redibujar
+     * (temas, atenuado).
+     */
+    void setPaletteColor(uint8_t index, PanelColor color);
+    /** @brief Sustituye `count` entradas de la paleta a partir de la 0. */
+    void setPalette(const PanelColor* colors, uint8_t count);
+    /** @brief Restaura la paleta por defecto (los colores definidos arriba). */
+    void resetPalette();
+    /** @brief Devuelve el color de una entrada de la paleta. */
+    PanelColor getPaletteColor(uint8_t index) { return palette[index & (PALETTE_SIZE - 1)]; }
+
+    // Recorte y traslación
+    /**
+     * @brief Limita el dibujo a un rectángulo (en coordenadas locales).
+     *
+     * Se interseca con el recorte actual. Todas las primitivas recortan sus
+     * tramos contra él antes de enviar nada: lo que cae fuera no gasta SPI,
+     * framebuffer ni lista de dibujo.
+     * @return false si la pila está llena; en ese caso no hay que llamar a popClip().
+     */
+    bool pushClip(int x, int y, int width, int height);
+    /**
+     * @brief Como pushClip() y además lleva el origen a la esquina del rectángulo.
+     *
+     * Un widget dibuja en sus propias coordenadas (0,0 = su esquina) sin poder
+     * salirse de sus límites.
+     */
+    bool pushViewport(int x, int y, int width, int height);
+    /** @brief Restaura el recorte y el origen anteriores al último push. */
+    void popClip();
+    /** @brief Vacía la pila: sin recorte y con el origen en 0,0. */
+    void resetClip();
+    /** @brief Recorte actual en coordenadas locales (toda la pantalla si no hay ninguno). */
+    GfxRect getClip();
+
     // Control de brillo
     /** @brief Ajusta el brillo de la retroiluminación (0..100). */
     void setBrightness(uint8_t brightness);
     
     // Funciones básicas de dibujo
     /** @brief Rellena toda la pantalla con un color. */
-    void clearScreen(uint16_t color = BLACK);
+    void clearScreen(PanelColor color = BLACK);
     /** @brief Fuerza un refresco completo del display (si la implementación lo requiere). */
     void forceRefresh(); // Forzar refresco completo del display
     /** @brief Dibuja un píxel en coordenadas x,y. */
-    void drawPixel(int x, int y, uint16_t color);
+    void drawPixel(int x, int y, PanelColor color);
     /** @brief Dibuja una línea entre dos puntos. */
-    void drawLine(int x0, int y0, int x1, int y1, uint16_t color);
-    void drawHLine(int x, int y, int width, uint16_t color);
-    void drawVLine(int x, int y, int height, uint16_t color);
+    void drawLine(int x0, int y0, int x1, int y1, PanelColor color);
+    void drawHLine(int x, int y, int width, PanelColor color);
+    void drawVLine(int x, int y, int height, PanelColor color);
     
     // Rectángulos
-    void drawRect(int x, int y, int width, int height, uint16_t color);
-    void fillRect(int x, int y, int width, int height, uint16_t color);
-    void drawRoundRect(int x, int y, int width, int height, int radius, uint16_t color);
-    void fillRoundRect(int x, int y, int width, int height, int radius, uint16_t color);
+    void drawRect(int x, int y, int width, int height, PanelColor color);
+    void fillRect(int x, int y, int width, int height, PanelColor color);
+    void drawRoundRect(int x, int y, int width, int height, int radius, PanelColor color);
+    void fillRoundRect(int x, int y, int width, int height, int radius, PanelColor color);
     
     // Círculos
-    void drawCircle(int x, int y, int radius, uint16_t color);
-    void fillCircle(int x, int y, int radius, uint16_t color);
+    void drawCircle(int x, int y, int radius, PanelColor color);
+    void fillCircle(int x, int y, int radius, PanelColor color);
     
     // Triángulos
-    void drawTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color);
-    void fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color);
+    void drawTriangle(int x0, int y0, int x1, int y1, int x2, int y2, PanelColor color);
+    void fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, PanelColor color);
     
     // Funciones de texto
-    void drawChar(int x, int y, char c, uint16_t textColor, uint16_t bgColor = BLACK, uint8_t size = 1);
-    void drawText(int x, int y, const String& text, uint16_t textColor, uint16_t bgColor = BLACK, uint8_t size = 1);
-    void drawText(int x, int y, const char* text, uint16_t textColor, uint16_t bgColor = BLACK, uint8_t size = 1);
+    void drawChar(int x, int y, char c, PanelColor textColor, PanelColor bgColor = BLACK, uint8_t size = 1);
+    void drawText(int x, int y, const String& text, PanelColor textColor, PanelColor bgColor = BLACK, uint8_t size = 1);
+    void drawText(int x, int y, const char* text, PanelColor textColor, PanelColor bgColor = BLACK, uint8_t size = 1);
     
-    // Texto con alineación
-    void drawAlignedText(int y, const String& text, uint8_t alignment, uint16_t textColor, uint16_t bgColor = BLACK, uint8_t size = 1);
-    void drawCenteredText(int y, const String& text, uint16_t textColor, uint16_t bgColor = BLACK, uint8_t size = 1);
+    /**
+     * @brief Activa la caché de glifos escalados (tamaño >= 2) con `bytes` de presupuesto.
+     *
+     * Cada carácter se rasteriza una vez por combinación de colores y tamaño;
+     * después cada fila del texto es una copia desde la caché. bytes = 0 la desactiva.
+     */
+    bool enableGlyphCache(uint32_t bytes);
+    /** @brief Aciertos, fallos y memoria de la caché de glifos. */
+    GlyphCacheStats getGlyphCacheStats() { return glyphCache.getStats(); }
+
+    // Texto con alineación (dentro del recorte actual; sin recorte, la pantalla)
+    void drawAlignedText(int y, const String& text, uint8_t alignment, PanelColor textColor, PanelColor bgColor = BLACK, uint8_t size = 1);
+    void drawAlignedText(int y, const char* text, uint8_t alignment, PanelColor textColor, PanelColor bgColor = BLACK, uint8_t size = 1);
+    void drawCenteredText(int y, const String& text, PanelColor textColor, PanelColor bgColor = BLACK, uint8_t size = 1);
+    void drawCenteredText(int y, const char* text, PanelColor textColor, PanelColor bgColor = BLACK, uint8_t size = 1);
     
     // Utilidades de texto
     int getTextWidth(const String& text, uint8_t size = 1);
@@ -129,22 +350,85 @@ public:
      * @param size Tamaño de fuente (usa getCharHeight para calcular la altura).
      * @param bgColor Color de fondo para rellenar (por defecto BLACK).
      */
-    void clearCenteredLine(int y, uint8_t size = 3, uint16_t bgColor = BLACK);
+    void clearCenteredLine(int y, uint8_t size = 3, PanelColor bgColor = BLACK);
     
+    // Imágenes
+    /**
+     * @brief Dibuja una imagen recortada a la pantalla y, si se indica, a `clip`.
+     *
+     * Sin color transparente el recorte visible es una sola ventana cuyas
+     * filas se generan directamente en el buffer DMA (RGB565 cambia de orden
+     * de dos en dos píxeles). Con GfxBitmap::key se envía un tramo por cada
+     * racha de píxeles visibles de la fila.
+     */
+    void drawImage(int x, int y, const GfxBitmap& bitmap, const GfxRect* clip = nullptr);
+    /**
+     * @brief Dibuja en x,y sólo la región `src` de la imagen (iconos de un atlas).
+     *
+     * Sólo se decodifican las filas y columnas de la región.
+     */
+    void drawImageRegion(int x, int y, const GfxBitmap& bitmap, const GfxRect& src);
+    /**
+     * @brief Dibuja un bitmap de 1 bit por píxel (ver GfxBitmap).
+     *
+     * Con bgColor == color los ceros son transparentes.
+     */
+    void drawBitmap(int x, int y, const uint8_t* bitmap, int width, int height, PanelColor color, PanelColor bgColor = BLACK);
+
     // Funciones avanzadas
-    void drawBitmap(int x, int y, const uint8_t* bitmap, int width, int height, uint16_t color, uint16_t bgColor = BLACK);
     void drawProgressBar(int x, int y, int width, int height, int progress, int maxProgress, 
-                        uint16_t fillColor = GREEN, uint16_t bgColor = DARKGRAY, uint16_t borderColor = WHITE);
+                        PanelColor fillColor = GREEN, PanelColor bgColor = DARKGRAY, PanelColor borderColor = WHITE);
     
     // Efectos visuales
-    void fadeScreen(uint16_t toColor, int steps = 50, int delayMs = 20);
-    void scrollText(int y, const String& text, uint16_t textColor, uint16_t bgColor = BLACK, 
+    void fadeScreen(PanelColor toColor, int steps = 50, int delayMs = 20);
+    void scrollText(int y, const String& text, PanelColor textColor, PanelColor bgColor = BLACK, 
                    uint8_t size = 1, int speed = 100);
+
+    // Scroll por hardware
+    /**
+     * @brief Define una franja desplazable por hardware.
+     *
+     * El eje de scroll es el lado largo del panel: X en horizontal, Y en
+     * vertical. La franja [start, start+length) abarca todo el otro eje.
+     * @return false si la franja no cabe en el panel.
+     */
+    bool setScrollArea(int start, int length);
+    /** @brief Desactiva el scroll y restaura el mapeo normal de la memoria. */
+    void resetScroll();
+    /**
+     * @brief Desplaza la franja `pixels` hacia su inicio moviendo sólo el registro de scroll.
+     *
+     * Rellena con fillColor la parte que queda al descubierto al final de la
+     * franja; sólo esa parte viaja por SPI.
+     * @return Coordenada (ya mapeada, ver scrollMap) donde dibujar el contenido nuevo.
+     */
+    int scrollBy(int pixels, PanelColor fillColor = BLACK);
+    /**
+     * @brief Traduce una posición visible del eje de scroll a la coordenada de dibujo.
+     *
+     * Dentro de la franja, lo dibujado en scrollMap(p) aparece en pantalla en p.
+     */
+    int scrollMap(int pos);
     
     // Utilidades de color
-    uint16_t color565(uint8_t r, uint8_t g, uint8_t b);
-    void getRGB(uint16_t color, uint8_t& r, uint8_t& g, uint8_t& b);
-    uint16_t interpolateColor(uint16_t color1, uint16_t color2, float ratio);
+    /** @brief Igual que ::color565 (PanelColor.h); se mantiene por compatibilidad. */
+    PanelColor color565(uint8_t r, uint8_t g, uint8_t b) { return ::color565(r, g, b); }
+    void getRGB(PanelColor color, uint8_t& r, uint8_t& g, uint8_t& b);
+    PanelColor interpolateColor(PanelColor color1, PanelColor color2, float ratio);
+
+    // Composición con transparencia (necesita framebuffer para leer el fondo)
+    /**
+     * @brief Mezcla un rectángulo de color sobre lo ya dibujado.
+     * @param alpha 0 (invisible) .. 255 (opaco, equivale a fillRect).
+     * @return false si no hay framebuffer activo (el panel no se puede leer).
+     */
+    bool fillRectAlpha(int x, int y, int width, int height, PanelColor color, uint8_t alpha);
+    /**
+     * @brief Pinta `color` con la opacidad de cada byte de `mask` (width x height, 0..255).
+     *
+     * Útil para iconos suavizados. Igual que fillRectAlpha, requiere framebuffer.
+     */
+    bool drawAlphaMask(int x, int y, int width, int height, const uint8_t* mask, PanelColor color);
     
     // Información
     int getWidth() { return SCREEN_WIDTH; }
@@ -152,11 +436,85 @@ public:
     
 private:
     // Funciones auxiliares
-    void drawCircleHelper(int x0, int y0, int r, uint8_t cornername, uint16_t color);
-    void fillCircleHelper(int x0, int y0, int r, uint8_t cornername, int delta, uint16_t color);
     void swap(int& a, int& b);
+    void flushLineRun(int x, int y, int len, bool horizontal, int step, PanelColor color);
+    bool compositeRect(int x, int y, int w, int h, PanelColor color, const uint8_t* mask, int stride, uint8_t alpha);
     // Habilita suavizado ligero para texto escalado
     bool textAAEnabled;
+
+    // Estado del scroll por hardware (scrollLength == 0: inactivo)
+    int scrollStart;
+    int scrollLength;
+    uint16_t scrollTopLine;   // Primera línea de barrido de la franja (TFA)
+    uint16_t scrollLines;     // Desplazamiento actual, en líneas de barrido
+    void fillScrollStrip(int from, int count, PanelColor color);
+
+    // Recorte (coordenadas de pantalla) y origen; la pila guarda los anteriores
+    struct ClipState {
+        GfxRect clip;
+        int16_t originX, originY;
+    };
+    ClipState clipState;
+    ClipState clipStack[CLIP_STACK_DEPTH];
+    int clipDepth;
+    bool clipToScreen(int& x, int& y, int& w, int& h);
+
+    // Framebuffer y rectángulos sucios
+    uint16_t* framebuffer;        // Píxeles en orden del panel
+    GfxRect dirty[MAX_DIRTY_RECTS];
+    int dirtyCount;
+    void markDirty(int x, int y, int w, int h);
+
+    // Framebuffer indexado: dos píxeles por byte (nibble bajo = x par)
+    uint8_t* indexedBuffer;
+    PanelColor palette[PALETTE_SIZE];
+    uint32_t paletteLut[256];     // Byte de índices -> dos colores en orden del panel
+    PanelColor lastColor;           // Caché de la última traducción color -> índice
+    uint8_t lastIndex;
+    void rebuildPaletteLut();
+    uint8_t paletteIndex(PanelColor color);
+    void flushIndexedRect(const GfxRect& r);
+
+    // Lista de dibujo para el renderizado por franjas
+    GfxOp* dlOps;
+    uint8_t* dlArena;
+    int dlCount;
+    int dlArenaUsed;
+    bool dlRecording;
+    GfxOp* recordOp(uint8_t type, int x, int y, int w, int h, uint32_t dataBytes);
+    void renderDisplayList(bool endOfFrame = false);
+    int opRowSpans(const GfxOp& op, int y, int16_t* x0, int16_t* x1);
+    void renderOpRow(const GfxOp& op, int y, int x0, int x1, uint16_t* dst);
+
+    // Comparación entre cuadros: resumen por baldosa del cuadro en curso y del último enviado
+    bool frameDiff;
+    bool tilesStale;        // El panel ya no coincide con prevTileHash
+    bool frameSkipTiles;    // Este cuadro puede omitir las baldosas sin cambios
+    uint32_t tileHash[DIFF_TILE_ROWS * DIFF_TILE_COLS];
+    uint32_t prevTileHash[DIFF_TILE_ROWS * DIFF_TILE_COLS];
+    void hashDisplayList();
+
+    // Capa de rasterizado (recorta a pantalla y escribe en panel, framebuffer o lista)
+    void rasterFill(int x, int y, int w, int h, PanelColor color);
+    void rasterPixels(int x, int y, int w, int h, const uint16_t* pixels);
+    void rasterRows(int x, int y, int w, int h, GfxRowGenerator gen, const void* ctx, uint32_t ctxBytes);
+    void storeIndexed(int x, int y, int w, const uint16_t* src);
+    void bufferFill(int x, int y, int w, int h, PanelColor color);
+    void rasterShape(const GfxShape& shape, PanelColor color);
+    GfxShape roundRectShape(int x, int y, int w, int h, int r, bool outline);
+
+    // Fuente proporcional con suavizado
+    const AAFont* currentFont;
+    const AAGlyph* fontGlyph(uint8_t c);
+    int fontTextWidth(const char* text);
+    void blitFontText(int x, int y, const char* text, PanelColor textColor, PanelColor bgColor);
+    static void fontRowGenerator(const void* ctx, int row, int x0, int x1, uint16_t* dst);
+
+    // Texto: una ventana por cadena, filas generadas desde font5x8
+    void blitText(int x, int y, const char* text, int len, PanelColor textColor, PanelColor bgColor, uint8_t size);
+    static void textRowGenerator(const void* ctx, int row, int x0, int x1, uint16_t* dst);
+    GlyphCache glyphCache;
+    void cacheGlyph(uint8_t c, PanelColor textColor, PanelColor bgColor, uint8_t size);
 };
 
 // Instancia global para facilitar el uso
@@ -0,0 +1,90 @@
+/**
+ * @file StackString.h
+ * @brief Cadena de capacidad fija sin memoria dinámica.
+ *
+ * Sustituye a String en los caminos que se ejecutan con cada pulsación
+ * (mensajes de estado, etiquetas, claves de NVS): vive en la pila o dentro
+ * del objeto que la contiene y nunca llama a malloc. Lo que no cabe se
+ * trunca; el resultado siempre termina en '\0'.
+ *
+ *     StackString<24> msg("Note ON ");
+ *     msg.append(value);
+ */
+#ifndef STACK_STRING_H
+#define STACK_STRING_H
+
+#include <Arduino.h>
+
+template <size_t N>
+class StackString {
+    static_assert(N >= 2 && N <= 256, "capacidad de 1 a 255 caracteres");
+
+public:
+    StackString() { clear(); }
+    StackString(const char* text) {
+        clear();
+        append(text);
+    }
+
+    void clear() {
+        len = 0;
+        buf[0] = '\0';
+    }
+
+    /** @brief Añade texto (se trunca al llenarse). */
+    StackString& append(const char* text) {
+        if (!text) return *this;
+        while (*text && len < N - 1) buf[len++] = *text++;
+        buf[len] = '\0';
+        return *this;
+    }
+
+    StackString& append(char c) {
+        if (len < N - 1) {
+            buf[len++] = c;
+            buf[len] = '\0';
+        }
+        return *this;
+    }
+
+    /** @brief Añade un entero en decimal. */
+    StackString& append(long value) {
+        unsigned long magnitude = (unsigned long)value;
+        if (value < 0) {
+            append('-');
+            magnitude = 0ul - magnitude;
+        }
+        char digits[20];
+        int count = 0;
+        do {
+            digits[count++] = (char)('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude);
+        while (count) append(digits[--count]);
+        return *this;
+    }
+
+    StackString& append(int value) { return append((long)value); }
+    StackString& append(uint8_t value) { return append((long)value); }
+
+    template <size_t M>
+    StackString& append(const StackString<M>& other) { return append(other.c_str()); }
+
+    const char* c_str() const { return buf; }
+    size_t length() const { return len; }
+    bool isEmpty() const { return len == 0; }
+    static constexpr size_t capacity() { return N - 1; }
+
+    bool operator==(const char* text) const { return strcmp(buf, text ? text : "") == 0; }
+    bool operator!=(const char* text) const { return !(*this == text); }
+    template <size_t M>
+    bool operator==(const StackString<M>& other) const { return strcmp(buf, other.c_str()) == 0; }
+    template <size_t M>
+    bool operator!=(const StackString<M>& other) const { return !(*this == other); }
+
+private:
+    char buf[N];
+    uint8_t len;
+};
+
+#endif // STACK_STRING_H
@@ -0,0 +1,170 @@
+#include "UIWidgets.h"
+
+// ---------------------------------------------------------------------------
+// Widget
+// ---------------------------------------------------------------------------
+
+Widget::Widget() {
+  bounds = {0, 0, 0, 0};
+  dirty = true;
+  changed = false;
+}
+
+void Widget::place(int x, int y, int width, int height) {
+  bounds = {(int16_t)x, (int16_t)y, (int16_t)width, (int16_t)height};
+  dirty = true;
+}
+
+void Widget::render() {
+  if (!isDirty()) return;
+  display.pushViewport(bounds.x, bounds.y, bounds.w, bounds.h);
+  draw();
+  display.popClip();
+  dirty = false;
+  changed = false;
+}
+
+// ---------------------------------------------------------------------------
+// LabelWidget
+// ---------------------------------------------------------------------------
+
+LabelWidget::LabelWidget() {
+  color = WHITE;
+  shownColor = WHITE;
+  bgColor = BLACK;
+  font = nullptr;
+  textY = 0;
+  size = 1;
+}
+
+void LabelWidget::setStyle(int textY, PanelColor bgColor, uint8_t size, const AAFont* font) {
+  this->textY = textY;
+  this->bgColor = bgColor;
+  this->size = size;
+  this->font = font;
+  dirty = true;
+}
+
+void LabelWidget::setText(const char* text, PanelColor color) {
+  this->text.clear();
+  this->text.append(text);
+  this->color = color;
+  changed = this->text != shownText || color != shownColor;
+}
+
+void LabelWidget::draw() {
+  shownText = text;
+  shownColor = color;
+  if (text.isEmpty()) return;
+  const AAFont* previous = display.getFont();
+  display.setFont(font);
+  int width = bounds.w, height = bounds.h;
+  int textW = display.getTextWidth(text.c_str(), size);
+  int textH = display.getCharHeight(size);
+  int textX = (width - textW) / 2;
+  display.fillRect(0, 0, width, textY, bgColor);
+  display.fillRect(0, textY + textH, width, height - textY - textH, bgColor);
+  display.fillRect(0, textY, textX, textH, bgColor);
+  display.fillRect(textX + textW, textY, width - textX - textW, textH, bgColor);
+  display.drawText(textX, textY, text.c_str(), color, bgColor, size);
+  display.setFont(previous);
+}
+
+// ---------------------------------------------------------------------------
+// HeaderWidget
+// ---------------------------------------------------------------------------
+
+HeaderWidget::HeaderWidget() {
+  version = nullptr;
+}
+
+void HeaderWidget::setVersion(const char* version) {
+  if (version == this->version) return;
+  this->version = version;
+  dirty = true;
+}
+
+void HeaderWidget::draw() {
+  display.drawCenteredText(10, "MIDI CONTROLLER", CYAN, BLACK, 2);
+  if (version) display.drawText(180, 10, version, YELLOW, BLACK, 2);
+  display.drawHLine(0, bounds.h - 1, bounds.w, DARKGRAY);
+}
+
+// ---------------------------------------------------------------------------
+// PadWidget
+// ---------------------------------------------------------------------------
+
+PadWidget::PadWidget() {
+  on = false;
+  shownOn = false;
+}
+
+void PadWidget::setState(bool on) {
+  this->on = on;
+  changed = on != shownOn;
+}
+
+void PadWidget::draw() {
+  shownOn = on;
+  PanelColor fillColor = on ? GREEN : DARKGRAY;
+  PanelColor borderColor = on ? WHITE : GRAY;
+  PanelColor textColor = on ? BLACK : WHITE;
+
+  display.fillRoundRect(0, 0, bounds.w, bounds.h, 5, fillColor);
+  display.drawRoundRect(0, 0, bounds.w, bounds.h, 5, borderColor);
+
+  int textY = (bounds.h - display.getCharHeight(2)) / 2;
+  display.drawCenteredText(textY, on ? "ON" : "OFF", textColor, fillColor, 2);
+}
+
+// ---------------------------------------------------------------------------
+// MenuTitleWidget
+// ---------------------------------------------------------------------------
+
+MenuTitleWidget::MenuTitleWidget() {
+  title = nullptr;
+  shownTitle = nullptr;
+}
+
+void MenuTitleWidget::setTitle(const char* title) {
+  this->title = title;
+  changed = title != shownTitle;
+}
+
+void MenuTitleWidget::draw() {
+  shownTitle = title;
+  display.fillRect(0, 0, bounds.w, bounds.h - 1, BLACK);
+  if (title) display.drawText(10, 10, title, CYAN, BLACK, 2);
+  display.drawHLine(0, bounds.h - 1, bounds.w, CYAN);
+}
+
+// ---------------------------------------------------------------------------
+// MenuRowWidget
+// ---------------------------------------------------------------------------
+
+MenuRowWidget::MenuRowWidget() {
+  label = nullptr;
+  selected = false;
+  shownLabel = nullptr;
+  shownSelected = false;
+}
+
+void MenuRowWidget::setItem(const char* label, const char* value, bool selected) {
+  this->label = label;
+  this->value.clear();
+  this->value.append(value);
+  this->selected = label && selected;
+  changed = label != shownLabel || this->value != shownValue || this->selected != shownSelected;
+}
+
+void MenuRowWidget::draw() {
+  shownLabel = label;
+  shownValue = value;
+  shownSelected = selected;
+  PanelColor bgColor = selected ? WHITE : BLACK;
+  PanelColor textColor = selected ? BLACK : WHITE;
+  display.fillRect(0, 0, bounds.w, bounds.h, bgColor);
+  if (!label) return;
+  display.drawText(10, 5, label, textColor, bgColor, 2);
+  if (!value.isEmpty()) display.drawText(160, 5, value.c_str(), textColor, bgColor, 2);
+}
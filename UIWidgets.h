@@ -0,0 +1,171 @@
+/**
+ * @file UIWidgets.h
+ * @brief Widgets retenidos de la pantalla principal.
+ *
+ * Cada widget recuerda lo que pintó por última vez y sólo queda sucio
+ * mientras su estado difiera de eso: ON -> OFF -> ON antes de repintar no
+ * cuesta nada. PedalboardUI::update() repinta los sucios en un único cuadro,
+ * de modo que una pulsación que no altera la pantalla no genera tráfico SPI.
+ */
+#ifndef UI_WIDGETS_H
+#define UI_WIDGETS_H
+
+#include "ST7789_Graphics.h"
+#include "StackString.h"
+
+/** Caracteres (con el terminador) que guarda un LabelWidget. */
+#define LABEL_TEXT_MAX 32
+
+/**
+ * @class Widget
+ * @brief Caja de pantalla que se repinta sólo cuando está sucia.
+ *
+ * draw() trabaja en coordenadas locales con el recorte en la caja del widget
+ * y anota lo que pinta. Un widget recién colocado o invalidado se repinta
+ * aunque su estado no haya cambiado.
+ */
+class Widget {
+public:
+    Widget();
+    virtual ~Widget() {}
+
+    /** @brief Fija la caja del widget (coordenadas de pantalla) y lo ensucia. */
+    void place(int x, int y, int width, int height);
+    /** @brief Fuerza el repintado en la siguiente pasada. */
+    void invalidate() { dirty = true; }
+    bool isDirty() const { return dirty || changed; }
+    /** @brief Pinta el widget si está sucio y lo marca limpio. */
+    void render();
+
+protected:
+    virtual void draw() = 0;
+
+    GfxRect bounds;
+    bool dirty;     // Repintar sí o sí
+    bool changed;   // El estado difiere del último pintado (lo mantienen los setters)
+};
+
+/**
+ * @class LabelWidget
+ * @brief Texto centrado sobre una franja de color.
+ *
+ * El fondo sólo rodea al texto (que ya lleva el suyo), así que cada píxel de
+ * la caja se envía una vez. Con fuente proporcional `size` se ignora.
+ */
+class LabelWidget : public Widget {
+public:
+    LabelWidget();
+
+    /** @brief Estilo fijo; textY es relativo a la parte superior de la caja. */
+    void setStyle(int textY, PanelColor bgColor, uint8_t size, const AAFont* font = nullptr);
+    /**
+     * @brief Cambia el texto y su color; sólo ensucia si difieren de lo pintado.
+     *
+     * Una etiqueta sin texto no pinta nada (la barra de estado no aparece
+     * hasta el primer mensaje).
+     */
+    void setText(const char* text, PanelColor color);
+
+protected:
+    void draw() override;
+
+private:
+    StackString<LABEL_TEXT_MAX> text;
+    PanelColor color;
+    StackString<LABEL_TEXT_MAX> shownText;
+    PanelColor shownColor;
+    PanelColor bgColor;
+    const AAFont* font;
+    int16_t textY;
+    uint8_t size;
+};
+
+/**
+ * @class HeaderWidget
+ * @brief Título, versión y línea separadora de la parte superior.
+ *
+ * Sólo pinta texto y línea: el fondo lo deja el borrado de pantalla completa,
+ * que es cuando se invalida.
+ */
+class HeaderWidget : public Widget {
+public:
+    HeaderWidget();
+
+    void setVersion(const char* version);
+
+protected:
+    void draw() override;
+
+private:
+    const char* version;
+};
+
+/**
+ * @class PadWidget
+ * @brief Botón redondeado ON/OFF de un pulsador.
+ */
+class PadWidget : public Widget {
+public:
+    PadWidget();
+
+    /** @brief Cambia el estado; sólo ensucia si difiere del pintado. */
+    void setState(bool on);
+
+protected:
+    void draw() override;
+
+private:
+    bool on;
+    bool shownOn;
+};
+
+/**
+ * @class MenuTitleWidget
+ * @brief Título del menú con su línea separadora.
+ */
+class MenuTitleWidget : public Widget {
+public:
+    MenuTitleWidget();
+
+    /** @brief Cambia el título (literal: se compara y guarda el puntero). */
+    void setTitle(const char* title);
+
+protected:
+    void draw() override;
+
+private:
+    const char* title;
+    const char* shownTitle;
+};
+
+/**
+ * @class MenuRowWidget
+ * @brief Una fila visible del menú: etiqueta, valor y resaltado.
+ *
+ * Las filas son huecos fijos de la pantalla; PedalboardUI les asigna el ítem
+ * que cae en cada uno. Pinta su caja entera (fondo incluido), así que mover
+ * la selección repinta sólo las dos filas afectadas sin borrar la pantalla.
+ */
+class MenuRowWidget : public Widget {
+public:
+    MenuRowWidget();
+
+    /**
+     * @brief Asigna el ítem de la fila; sólo ensucia si difiere de lo pintado.
+     * @param label Literal (se compara por puntero); nullptr deja la fila vacía.
+     */
+    void setItem(const char* label, const char* value, bool selected);
+
+protected:
+    void draw() override;
+
+private:
+    const char* label;
+    StackString<LABEL_TEXT_MAX> value;
+    bool selected;
+    const char* shownLabel;
+    StackString<LABEL_TEXT_MAX> shownValue;
+    bool shownSelected;
+};
+
+#endif // UI_WIDGETS_H
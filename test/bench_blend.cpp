@@ -0,0 +1,95 @@
+/**
+ * Mezcla RGB565: interpolación en float (la de antes de RGB565Blend.h)
+ * frente a los kernels SWAR.
+ *
+ * Primero comprueba que cada canal de rgb565Blend sea exactamente
+ * bg + floor((fg - bg) * a / 32), con a = alpha reducido a 5 bits; después
+ * mide ns por píxel de cada variante. Uso: ./bench_blend [llamadas]
+ */
+#include <chrono>
+#include "RGB565Blend.h"
+
+// interpolateColor() anterior, en RGB565 nativo
+static uint16_t interpolateFloat(uint16_t color1, uint16_t color2, float ratio) {
+  if (ratio <= 0) return color1;
+  if (ratio >= 1) return color2;
+  uint8_t r1 = (color1 >> 8) & 0xF8, g1 = (color1 >> 3) & 0xFC, b1 = (color1 << 3) & 0xF8;
+  uint8_t r2 = (color2 >> 8) & 0xF8, g2 = (color2 >> 3) & 0xFC, b2 = (color2 << 3) & 0xF8;
+  uint8_t r = r1 + (r2 - r1) * ratio;
+  uint8_t g = g1 + (g2 - g1) * ratio;
+  uint8_t b = b1 + (b2 - b1) * ratio;
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+static uint32_t rngState = 12345;
+static uint32_t nextRandom() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+static int blendChannel(int bg, int fg, int a) {
+  int d = (fg - bg) * a;
+  return bg + (d >= 0 ? d / 32 : -((-d + 31) / 32));
+}
+
+static long checkExact(long samples) {
+  long mismatches = 0;
+  for (long i = 0; i < samples; i++) {
+    uint16_t bg = nextRandom(), fg = nextRandom();
+    uint8_t alpha = nextRandom();
+    int a = (alpha + 4) >> 3;
+    uint16_t got = rgb565Blend(bg, fg, alpha);
+    bool ok = (got >> 11) == blendChannel(bg >> 11, fg >> 11, a) &&
+              ((got >> 5) & 0x3F) == blendChannel((bg >> 5) & 0x3F, (fg >> 5) & 0x3F, a) &&
+              (got & 0x1F) == blendChannel(bg & 0x1F, fg & 0x1F, a);
+    if (!ok) mismatches++;
+  }
+  return mismatches;
+}
+
+// Entradas precalculadas para que el bucle mida la mezcla y no el generador
+static const int TABLE = 4096;
+static uint16_t bgs[TABLE], fgs[TABLE];
+static uint8_t alphas[TABLE];
+static float ratios[TABLE];
+static volatile uint16_t sink;
+
+template <typename F>
+static void measure(const char* name, long calls, F blend) {
+  auto start = std::chrono::steady_clock::now();
+  uint16_t acc = 0;
+  for (long i = 0; i < calls; i++) acc ^= blend(i & (TABLE - 1));
+  sink = acc;
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  printf("%-24s %6.2f ns/px\n", name, ns / calls);
+}
+
+int main(int argc, char** argv) {
+  long calls = argc > 1 ? atol(argv[1]) : 50000000L;
+
+  long mismatches = checkExact(2000000);
+  printf("rgb565Blend exacta en 2M casos: %s (%ld distintos)\n", mismatches ? "NO" : "sí", mismatches);
+
+  for (int i = 0; i < TABLE; i++) {
+    bgs[i] = nextRandom();
+    fgs[i] = nextRandom();
+    alphas[i] = nextRandom();
+    ratios[i] = alphas[i] / 255.0f;
+  }
+  measure("float interpolateColor", calls, [](long i) { return interpolateFloat(bgs[i], fgs[i], ratios[i]); });
+  measure("SWAR rgb565Blend", calls, [](long i) { return rgb565Blend(bgs[i], fgs[i], alphas[i]); });
+
+  // Span con alpha por píxel, como el texto suavizado
+  static uint16_t row[TABLE];
+  memcpy(row, bgs, sizeof(row));
+  auto start = std::chrono::steady_clock::now();
+  long spans = calls / TABLE;
+  for (long s = 0; s < spans; s++) rgb565BlendSpanMask(row, fgs[s & (TABLE - 1)], alphas, TABLE);
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  sink = row[spans & (TABLE - 1)];
+  printf("%-24s %6.2f ns/px\n", "SWAR alpha-mask span", ns / ((double)spans * TABLE));
+
+  return mismatches ? 1 : 0;
+}
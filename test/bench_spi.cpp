@@ -0,0 +1,36 @@
+/**
+ * Tráfico SPI de las primitivas que usa la pantalla principal.
+ *
+ * Imprime aserciones de CS y bytes de cada caso, y el tiempo en el cable a
+ * 80 MHz. Para comparar con otra versión, ejecutarlo en cada checkout.
+ */
+#include "ST7789_Graphics.h"
+#include "spi_mock.h"
+
+static void report(const char* name) {
+  SpiMockStats s = SpiMock_Stats();
+  printf("%-26s %6u CS %8u bytes %8.1f us\n", name, s.csAssertions, s.bytes, s.bytes * 0.1);
+}
+
+#define BENCH(name, ...)  \
+  do {                    \
+    SpiMock_Reset();      \
+    __VA_ARGS__;          \
+    report(name);         \
+  } while (0)
+
+int main() {
+  display.begin(50);
+
+  // Relleno de áreas
+  BENCH("clearScreen", display.clearScreen(BLACK));
+  BENCH("status bar 320x25", display.fillRect(0, 140, 320, 25, DARKGRAY));
+  BENCH("button fillRoundRect", display.fillRoundRect(15, 60, 50, 50, 5, GREEN));
+  BENCH("button drawRoundRect", display.drawRoundRect(15, 60, 50, 50, 5, WHITE));
+
+  // Texto (font5x8)
+  BENCH("header text size 2", display.drawCenteredText(10, "MIDI CONTROLLER", CYAN, BLACK, 2));
+  BENCH("bank label size 2", display.drawCenteredText(45, "Bank 1", YELLOW, BLACK, 2));
+  BENCH("status text size 1", display.drawCenteredText(150, "Note ON 60", GREEN, DARKGRAY, 1));
+  return 0;
+}
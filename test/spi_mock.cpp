@@ -0,0 +1,134 @@
+#include <Arduino.h>
+#include <deque>
+#include "driver/spi_master.h"
+#include "driver/gpio.h"
+#include "Display_ST7789.h"
+#include "spi_mock.h"
+#include <SPI.h>
+
+HardwareSerial Serial;
+
+// El tiempo sólo avanza con delay(): los arranques no esperan de verdad
+static unsigned long fakeMillis = 0;
+unsigned long millis() { return fakeMillis; }
+unsigned long micros() { return fakeMillis * 1000; }
+void delay(unsigned long ms) { fakeMillis += ms; }
+
+static spi_device_interface_config_t device;
+static std::deque<spi_transaction_t*> pending;
+static SpiMockStats stats;
+static bool csActive = false;
+static int dcLevel = 0;
+
+// Memoria del panel [fila][columna] y decodificador de comandos
+static uint16_t panel[320][320];
+static uint8_t command = 0;
+static uint8_t params[4];
+static int paramCount = 0;
+static int colStart, colEnd, rowStart;
+static int col, row, highByte = -1;
+
+void gpio_set_level(gpio_num_t, int level) { dcLevel = level; }
+
+esp_err_t spi_bus_initialize(int, const spi_bus_config_t*, int) { return 0; }
+
+esp_err_t spi_bus_add_device(int, const spi_device_interface_config_t* dev, spi_device_handle_t* handle) {
+  device = *dev;
+  *handle = (spi_device_handle_t)1;
+  return 0;
+}
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t, uint32_t) { return 0; }
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t, spi_transaction_t* trans, uint32_t) {
+  pending.push_back(trans);
+  return 0;
+}
+
+static void receiveByte(uint8_t b) {
+  stats.bytes++;
+  if (!dcLevel) {
+    command = b;
+    paramCount = 0;
+    if (command == 0x2C) {
+      col = colStart;
+      row = rowStart;
+      highByte = -1;
+    }
+    return;
+  }
+  if (command == 0x2C) {
+    if (highByte < 0) {
+      highByte = b;
+      return;
+    }
+    if (row < 320 && col < 320) panel[row][col] = (uint16_t)((highByte << 8) | b);
+    highByte = -1;
+    if (++col > colEnd) {
+      col = colStart;
+      row++;
+    }
+    return;
+  }
+  if (paramCount < 4) params[paramCount] = b;
+  paramCount++;
+  if (paramCount == 4 && command == 0x2A) {
+    colStart = (params[0] << 8) | params[1];
+    colEnd = (params[2] << 8) | params[3];
+  }
+  if (paramCount == 4 && command == 0x2B) rowStart = (params[0] << 8) | params[1];
+}
+
+// El driver fija DC en pre_cb, así que las transacciones se ejecutan al recogerlas
+esp_err_t spi_device_get_trans_result(spi_device_handle_t, spi_transaction_t** trans, uint32_t) {
+  if (pending.empty()) {
+    fprintf(stderr, "spi_mock: get_trans_result sin transacciones pendientes\n");
+    abort();
+  }
+  spi_transaction_t* t = pending.front();
+  pending.pop_front();
+  if (device.pre_cb) device.pre_cb(t);
+  if (!csActive) stats.csAssertions++;
+  const uint8_t* data = (t->flags & SPI_TRANS_USE_TXDATA) ? t->tx_data : (const uint8_t*)t->tx_buffer;
+  for (size_t i = 0; i < t->length / 8; i++) receiveByte(data[i]);
+  csActive = (t->flags & SPI_TRANS_CS_KEEP_ACTIVE) != 0;
+  if (device.post_cb) device.post_cb(t);
+  *trans = t;
+  return 0;
+}
+
+// ---------------------------------------------------------------------------
+// SPIClass (drivers anteriores): sólo cuentan, sin decodificar el panel
+// ---------------------------------------------------------------------------
+
+void SPIClass::beginTransaction(SPISettings) { stats.csAssertions++; }
+uint8_t SPIClass::transfer(uint8_t) {
+  stats.bytes++;
+  return 0;
+}
+uint16_t SPIClass::transfer16(uint16_t) {
+  stats.bytes += 2;
+  return 0;
+}
+void SPIClass::transferBytes(const uint8_t*, uint8_t* out, uint32_t size) {
+  if (out) memset(out, 0, size);
+  stats.bytes += size;
+}
+void SPIClass::writeBytes(const uint8_t*, uint32_t size) { stats.bytes += size; }
+
+// Los drivers sin cola no lo definen; el actual lo sustituye
+__attribute__((weak)) void LCD_WaitIdle(void) {}
+
+void SpiMock_Reset(void) {
+  LCD_WaitIdle();
+  stats = {0, 0};
+}
+
+SpiMockStats SpiMock_Stats(void) {
+  LCD_WaitIdle();
+  return stats;
+}
+
+uint16_t SpiMock_Pixel(int x, int y) {
+  return panel[y + Offset_Y][x + Offset_X];
+}
@@ -0,0 +1,28 @@
+/**
+ * @file spi_mock.h
+ * @brief Bus SPI y panel ST7789 simulados para pruebas en el host.
+ *
+ * spi_mock.cpp implementa las funciones de spi_master.h que usa
+ * Display_ST7789.cpp: ejecuta cada transacción en orden, cuenta aserciones de
+ * CS (una transacción sin SPI_TRANS_CS_KEEP_ACTIVE la cierra) y bytes, e
+ * interpreta CASET/RASET/RAMWR sobre una memoria de 320x320 para poder leer
+ * lo que quedó en pantalla.
+ */
+#ifndef SPI_MOCK_H
+#define SPI_MOCK_H
+
+#include <stdint.h>
+
+typedef struct {
+  uint32_t csAssertions;  // Veces que CS pasó a activo
+  uint32_t bytes;         // Bytes en el cable (comandos + datos)
+} SpiMockStats;
+
+/** Pone a cero los contadores (espera antes a que el driver termine). */
+void SpiMock_Reset(void);
+/** Contadores desde el último SpiMock_Reset() (espera a que el driver termine). */
+SpiMockStats SpiMock_Stats(void);
+/** RGB565 nativo (como viaja por el cable) de un píxel lógico (aplica Offset_X/Offset_Y). */
+uint16_t SpiMock_Pixel(int x, int y);
+
+#endif // SPI_MOCK_H
@@ -0,0 +1,61 @@
+// Sustituto mínimo de Arduino.h para compilar el driver y la capa gráfica en el host.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define IRAM_ATTR
+#define DMA_ATTR
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+inline void delayMicroseconds(unsigned) {}
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline void ledcAttach(int, int, int) {}
+inline void ledcWrite(int, int) {}
+inline void yield() {}
+
+using std::min;
+using std::max;
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+class String {
+public:
+  String() {}
+  String(const char* c) : s(c ? c : "") {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+  String(char c) : s(1, c) {}
+  const char* c_str() const { return s.c_str(); }
+  unsigned length() const { return s.size(); }
+  char operator[](unsigned i) const { return s[i]; }
+  bool operator==(const char* o) const { return s == o; }
+  bool operator==(const String& o) const { return s == o.s; }
+  String& operator+=(const String& o) { s += o.s; return *this; }
+  friend String operator+(const String& a, const String& b) { return String((a.s + b.s).c_str()); }
+
+private:
+  std::string s;
+};
+
+struct HardwareSerial {
+  void begin(int) {}
+  void print(const char*) {}
+  void println(const char*) {}
+  void println(const String&) {}
+  template <class... A> void printf(const char*, A...) {}
+};
+extern HardwareSerial Serial;
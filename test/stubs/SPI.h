@@ -0,0 +1,24 @@
+// SPIClass de Arduino, sólo para medir versiones del driver anteriores a
+// spi_master: cada beginTransaction() cuenta como una aserción de CS.
+#pragma once
+#include <Arduino.h>
+
+#define FSPI 0
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+struct SPISettings {
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+public:
+  SPIClass(int) {}
+  void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+  void beginTransaction(SPISettings settings);
+  void endTransaction() {}
+  uint8_t transfer(uint8_t data);
+  uint16_t transfer16(uint16_t data);
+  void transferBytes(const uint8_t* data, uint8_t* out, uint32_t size);
+  void writeBytes(const uint8_t* data, uint32_t size);
+};
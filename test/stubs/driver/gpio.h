@@ -0,0 +1,3 @@
+#pragma once
+typedef int gpio_num_t;
+void gpio_set_level(gpio_num_t gpio, int level);
@@ -0,0 +1,46 @@
+// Subconjunto de spi_master.h que usa Display_ST7789.cpp; lo implementa spi_mock.cpp.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+#define SPI2_HOST 1
+#define SPI_DMA_CH_AUTO 3
+#define SPI_TRANS_USE_TXDATA (1 << 3)
+#define SPI_TRANS_CS_KEEP_ACTIVE (1 << 8)
+#define SPI_DEVICE_NO_DUMMY (1 << 6)
+#ifndef portMAX_DELAY
+#define portMAX_DELAY 0xFFFFFFFFu
+#endif
+
+typedef int esp_err_t;
+typedef struct spi_transaction_t {
+  uint32_t flags;
+  size_t length;    // En bits
+  size_t rxlength;
+  void* user;
+  union {
+    const void* tx_buffer;
+    uint8_t tx_data[4];
+  };
+  void* rx_buffer;
+} spi_transaction_t;
+typedef void (*transaction_cb_t)(spi_transaction_t* trans);
+typedef struct {
+  int mosi_io_num, miso_io_num, sclk_io_num, quadwp_io_num, quadhd_io_num;
+  int max_transfer_sz;
+} spi_bus_config_t;
+typedef struct {
+  int clock_speed_hz;
+  int mode;
+  int spics_io_num;
+  int queue_size;
+  uint32_t flags;
+  transaction_cb_t pre_cb, post_cb;
+} spi_device_interface_config_t;
+typedef struct spi_dev_t* spi_device_handle_t;
+
+esp_err_t spi_bus_initialize(int host, const spi_bus_config_t* bus, int dma);
+esp_err_t spi_bus_add_device(int host, const spi_device_interface_config_t* dev, spi_device_handle_t* handle);
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, uint32_t wait);
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* trans, uint32_t wait);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** trans, uint32_t wait);
@@ -0,0 +1,12 @@
+// heap_caps_* sobre malloc: en el host toda la memoria vale para DMA.
+#pragma once
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT 4
+#define MALLOC_CAP_DMA 8
+#define MALLOC_CAP_SPIRAM 1024
+#define MALLOC_CAP_INTERNAL 2048
+
+inline void* heap_caps_malloc(size_t n, unsigned) { return malloc(n); }
+inline void* heap_caps_calloc(size_t count, size_t n, unsigned) { return calloc(count, n); }
+inline void heap_caps_free(void* p) { free(p); }
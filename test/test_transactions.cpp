@@ -0,0 +1,70 @@
+/**
+ * Coste en el cable de las primitivas básicas: cada una debe abrir una sola
+ * ventana bajo una sola aserción de CS y enviar sólo la cabecera
+ * CASET/RASET/RAMWR más sus píxeles.
+ */
+#include "ST7789_Graphics.h"
+#include "spi_mock.h"
+
+static int failures = 0;
+
+#define CHECK_EQ(actual, expected)                                              \
+  do {                                                                          \
+    long a = (long)(actual), e = (long)(expected);                              \
+    if (a != e) {                                                               \
+      printf("%s:%d: %s = %ld, esperado %ld\n", __FILE__, __LINE__, #actual, a, e); \
+      failures++;                                                               \
+    }                                                                           \
+  } while (0)
+
+// Cabecera de ventana: 3 comandos + 4 bytes de CASET + 4 de RASET
+static const int WINDOW_BYTES = 11;
+
+static void testDrawPixel() {
+  SpiMock_Reset();
+  display.drawPixel(3, 4, RED);
+  SpiMockStats s = SpiMock_Stats();
+  CHECK_EQ(s.csAssertions, 1);
+  CHECK_EQ(s.bytes, WINDOW_BYTES + 2);
+  CHECK_EQ(SpiMock_Pixel(3, 4), RED.rgb565());
+}
+
+static void testFillRect() {
+  SpiMock_Reset();
+  display.fillRect(10, 20, 40, 30, GREEN);
+  SpiMockStats s = SpiMock_Stats();
+  CHECK_EQ(s.csAssertions, 1);
+  CHECK_EQ(s.bytes, WINDOW_BYTES + 40 * 30 * 2);
+  CHECK_EQ(SpiMock_Pixel(10, 20), GREEN.rgb565());
+  CHECK_EQ(SpiMock_Pixel(49, 49), GREEN.rgb565());
+
+  // Más grande que un buffer DMA: varias transacciones, una sola aserción
+  SpiMock_Reset();
+  display.fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, BLUE);
+  s = SpiMock_Stats();
+  CHECK_EQ(s.csAssertions, 1);
+  CHECK_EQ(s.bytes, WINDOW_BYTES + SCREEN_WIDTH * SCREEN_HEIGHT * 2);
+}
+
+static void testAddWindow() {
+  uint16_t pixels[8 * 5];
+  for (int i = 0; i < 8 * 5; i++) pixels[i] = (uint16_t)(i * 0x0841);
+  SpiMock_Reset();
+  LCD_addWindow(100, 50, 107, 54, pixels);
+  SpiMockStats s = SpiMock_Stats();
+  CHECK_EQ(s.csAssertions, 1);
+  CHECK_EQ(s.bytes, WINDOW_BYTES + 8 * 5 * 2);
+}
+
+int main() {
+  display.begin(50);
+  testDrawPixel();
+  testFillRect();
+  testAddWindow();
+  if (failures) {
+    printf("test_transactions: %d fallos\n", failures);
+    return 1;
+  }
+  printf("test_transactions: OK\n");
+  return 0;
+}
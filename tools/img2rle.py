@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+"""
+img2rle.py - Convierte imágenes PNG/PPM en un GfxBitmap RLE565 (ST7789_Graphics.h).
+
+Genera un .h con los datos comprimidos por rachas en un array constexpr,
+listo para display.drawImage(x, y, Nombre). Con varias imágenes de entrada
+las apila verticalmente en un único atlas y emite además NombreRects[] con
+el rectángulo de cada una, para display.drawImageRegion().
+
+Formato (ver GfxBitmap en ST7789_Graphics.h): tabla de desplazamientos de
+32 bits por fila y, por fila, fichas 0x00..0x7F (n+1 literales) o
+0x80..0xFF (un color repetido n-0x7F veces), colores con el byte alto primero.
+
+No depende de librerías externas: lee PNG (8 bits, o paleta de 1..8 bits,
+sin entrelazado) y PPM binario (P6).
+
+Uso:
+    python3 tools/img2rle.py splash.png --name Splash -o Splash.h
+    python3 tools/img2rle.py play.png stop.png rec.png --key 0xF81F \\
+        --name Icons -o Icons.h
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAX_RUN = 128  # Píxeles por ficha (7 bits + 1)
+
+
+# ---------------------------------------------------------------------------
+# Lectura de imágenes
+# ---------------------------------------------------------------------------
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(data):
+    """Devuelve (ancho, alto, filas de tuplas RGBA)."""
+    pos, idat, palette, trns = 8, b"", None, None
+    while pos < len(data):
+        length, kind = struct.unpack_from(">I4s", data, pos)
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    if interlace:
+        raise ValueError("PNG entrelazado no soportado")
+    if ctype != 3 and depth != 8:
+        raise ValueError("sólo PNG de 8 bits por canal (o con paleta)")
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    bits = channels * depth
+    stride = (width * bits + 7) // 8
+    bpp = max(1, bits // 8)
+    raw = zlib.decompress(idat)
+
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                line[i] = (line[i] + paeth(a, b, c)) & 0xFF
+        prev = line
+
+        row = []
+        for x in range(width):
+            if ctype == 3:
+                bit = x * depth
+                idx = (line[bit >> 3] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1)
+                alpha = trns[idx] if trns and idx < len(trns) else 255
+                row.append(palette[idx] + (alpha,))
+            elif ctype == 0:
+                g = line[x]
+                row.append((g, g, g, 255))
+            elif ctype == 4:
+                g = line[2 * x]
+                row.append((g, g, g, line[2 * x + 1]))
+            elif ctype == 2:
+                row.append(tuple(line[3 * x:3 * x + 3]) + (255,))
+            else:
+                row.append(tuple(line[4 * x:4 * x + 4]))
+        rows.append(row)
+    return width, height, rows
+
+
+def read_ppm(data):
+    fields, pos = [], 2
+    while len(fields) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(int(data[pos:end]))
+        pos = end
+    width, height, maxval = fields
+    if maxval != 255:
+        raise ValueError("sólo PPM de 8 bits")
+    pos += 1
+    rows = []
+    for y in range(height):
+        line = data[pos + y * width * 3:pos + (y + 1) * width * 3]
+        rows.append([tuple(line[3 * x:3 * x + 3]) + (255,) for x in range(width)])
+    return width, height, rows
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data.startswith(b"\x89PNG\r\n\x1a\n"):
+        return read_png(data)
+    if data.startswith(b"P6"):
+        return read_ppm(data)
+    raise ValueError("%s: formato no reconocido (PNG o PPM P6)" % path)
+
+
+# ---------------------------------------------------------------------------
+# Codificación
+# ---------------------------------------------------------------------------
+
+def to565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def convert(rows, key):
+    """RGBA -> RGB565; los píxeles transparentes pasan a ser `key`."""
+    out = []
+    for row in rows:
+        line = []
+        for r, g, b, a in row:
+            if key is not None and a < 128:
+                line.append(key)
+                continue
+            c = to565(r, g, b)
+            if c == key:
+                c ^= 0x0001  # Un opaco igual a la clave se volvería transparente
+            line.append(c)
+        out.append(line)
+    return out
+
+
+def encode_row(px):
+    out, i, n = bytearray(), 0, len(px)
+
+    def run_at(j):
+        k = j
+        while k < n and px[k] == px[j] and k - j < MAX_RUN:
+            k += 1
+        return k - j
+
+    while i < n:
+        r = run_at(i)
+        if r >= 2:
+            out.append(0x80 | (r - 1))
+            out += struct.pack(">H", px[i])
+            i += r
+            continue
+        # Literales hasta que empiece una racha que compense partirlos
+        j = i + 1
+        while j < n and j - i < MAX_RUN and run_at(j) < 3:
+            j += 1
+        out.append(j - i - 1)
+        for c in px[i:j]:
+            out += struct.pack(">H", c)
+        i = j
+    return out
+
+
+def encode(pixels):
+    height = len(pixels)
+    body, offsets = bytearray(), []
+    for row in pixels:
+        offsets.append(4 * height + len(body))
+        body += encode_row(row)
+    return b"".join(struct.pack("<I", o) for o in offsets) + bytes(body)
+
+
+# ---------------------------------------------------------------------------
+# Salida
+# ---------------------------------------------------------------------------
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("images", nargs="+", help="PNG o PPM; varias forman un atlas vertical")
+    ap.add_argument("--key", type=lambda v: int(v, 0), default=None,
+                    help="RGB565 para los píxeles transparentes (alpha < 128)")
+    ap.add_argument("--name", required=True, help="nombre de la variable GfxBitmap")
+    ap.add_argument("-o", "--output", required=True)
+    args = ap.parse_args()
+
+    images = [load(p) for p in args.images]
+    width = max(w for w, _, _ in images)
+    fill = args.key if args.key is not None else 0
+    pixels, rects, y = [], [], 0
+    for w, h, rows in images:
+        for line in convert(rows, args.key):
+            pixels.append(line + [fill] * (width - w))
+        rects.append((0, y, w, h))
+        y += h
+    if width > 0x7FFF or y > 0x7FFF:
+        sys.exit("la imagen supera 32767 píxeles de lado")
+
+    blob = encode(pixels)
+    name = args.name
+    src = ", ".join(os.path.basename(p) for p in args.images)
+    key = "0x%04X" % args.key if args.key is not None else "GFX_NO_KEY"
+    lines = [
+        "// %s" % os.path.basename(args.output),
+        "// Generado por tools/img2rle.py desde %s (%dx%d, %d bytes; %d sin comprimir). No editar a mano." % (
+            src, width, y, len(blob), width * y * 2),
+        "#pragma once",
+        '#include "ST7789_Graphics.h"',
+        "",
+        "static constexpr uint8_t %sData[] = {" % name,
+    ]
+    for i in range(0, len(blob), 16):
+        lines.append("  " + ", ".join("0x%02X" % b for b in blob[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static constexpr GfxBitmap %s = {%sData, nullptr, %d, %d, GFX_BITMAP_RLE565, %s};" % (
+        name, name, width, y, key))
+    if len(images) > 1:
+        lines.append("")
+        lines.append("static constexpr GfxRect %sRects[] = {" % name)
+        for path, (rx, ry, rw, rh) in zip(args.images, rects):
+            lines.append("  {%d, %d, %d, %d},  // %s" % (rx, ry, rw, rh, os.path.basename(path)))
+        lines.append("};")
+    lines.append("")
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines))
+    print("%s: %dx%d, %d bytes (%.1f%% del RGB565 crudo)" % (
+        args.output, width, y, len(blob), 100.0 * len(blob) / (width * y * 2)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,371 @@
+#!/usr/bin/env python3
+"""
+ttf2font.py - Convierte una fuente TrueType en una tabla AAFont (AAFont.h).
+
+Genera un .h con los glifos rasterizados con suavizado (2 o 4 bits de
+cobertura por píxel) empaquetados en arrays constexpr, listo para
+display.setFont(&Nombre).
+
+No depende de librerías externas: lee las tablas head/hhea/maxp/cmap/hmtx/
+loca/glyf directamente y rasteriza las curvas con sobremuestreo.
+
+Uso:
+    python3 tools/ttf2font.py /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf \\
+        --size 12 --bpp 2 --name FontSans12 -o Font_Sans12.h
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+SUPERSAMPLE = 4  # Muestras por eje y píxel (16 por píxel)
+
+
+# ---------------------------------------------------------------------------
+# Lectura TrueType
+# ---------------------------------------------------------------------------
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        self.tables = {}
+        num_tables = struct.unpack_from(">H", self.data, 4)[0]
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack_from(">4sIII", self.data, 12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (offset, length)
+
+        head = self.tables["head"][0]
+        self.units_per_em = struct.unpack_from(">H", self.data, head + 18)[0]
+        self.loca_long = struct.unpack_from(">h", self.data, head + 50)[0] == 1
+
+        hhea = self.tables["hhea"][0]
+        self.ascender, self.descender, self.line_gap = struct.unpack_from(">hhh", self.data, hhea + 4)
+        self.num_hmetrics = struct.unpack_from(">H", self.data, hhea + 34)[0]
+
+        self.num_glyphs = struct.unpack_from(">H", self.data, self.tables["maxp"][0] + 4)[0]
+        self.cmap = self._read_cmap()
+
+    def _read_cmap(self):
+        base = self.tables["cmap"][0]
+        count = struct.unpack_from(">H", self.data, base + 2)[0]
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from(">HHI", self.data, base + 4 + 8 * i)
+            sub = base + offset
+            if platform == 3 and encoding == 1 and struct.unpack_from(">H", self.data, sub)[0] == 4:
+                return self._read_cmap4(sub)
+        raise ValueError("la fuente no tiene cmap Unicode BMP (formato 4)")
+
+    def _read_cmap4(self, sub):
+        segx2 = struct.unpack_from(">H", self.data, sub + 6)[0]
+        seg = segx2 // 2
+        ends = struct.unpack_from(">%dH" % seg, self.data, sub + 14)
+        starts_at = sub + 16 + segx2
+        starts = struct.unpack_from(">%dH" % seg, self.data, starts_at)
+        deltas = struct.unpack_from(">%dh" % seg, self.data, starts_at + segx2)
+        ranges_at = starts_at + 2 * segx2
+        ranges = struct.unpack_from(">%dH" % seg, self.data, ranges_at)
+        mapping = {}
+        for i in range(seg):
+            for code in range(starts[i], ends[i] + 1):
+                if code == 0xFFFF:
+                    continue
+                if ranges[i] == 0:
+                    gid = (code + deltas[i]) & 0xFFFF
+                else:
+                    addr = ranges_at + 2 * i + ranges[i] + 2 * (code - starts[i])
+                    gid = struct.unpack_from(">H", self.data, addr)[0]
+                    if gid:
+                        gid = (gid + deltas[i]) & 0xFFFF
+                mapping[code] = gid
+        return mapping
+
+    def advance(self, gid):
+        hmtx = self.tables["hmtx"][0]
+        index = min(gid, self.num_hmetrics - 1)
+        return struct.unpack_from(">H", self.data, hmtx + 4 * index)[0]
+
+    def _glyph_offset(self, gid):
+        loca = self.tables["loca"][0]
+        if self.loca_long:
+            a, b = struct.unpack_from(">II", self.data, loca + 4 * gid)
+        else:
+            a, b = struct.unpack_from(">HH", self.data, loca + 2 * gid)
+            a, b = a * 2, b * 2
+        if a == b:
+            return None
+        return self.tables["glyf"][0] + a
+
+    def contours(self, gid, depth=0):
+        """Contornos del glifo como listas de (x, y, on_curve) en unidades de fuente."""
+        off = self._glyph_offset(gid)
+        if off is None or depth > 8:
+            return []
+        ncont = struct.unpack_from(">h", self.data, off)[0]
+        p = off + 10
+        if ncont >= 0:
+            return self._simple(p, ncont)
+        return self._composite(p, depth)
+
+    def _simple(self, p, ncont):
+        ends = struct.unpack_from(">%dH" % ncont, self.data, p)
+        p += 2 * ncont
+        ninstr = struct.unpack_from(">H", self.data, p)[0]
+        p += 2 + ninstr
+        npts = ends[-1] + 1 if ncont else 0
+
+        flags = []
+        while len(flags) < npts:
+            f = self.data[p]
+            p += 1
+            flags.append(f)
+            if f & 8:
+                repeat = self.data[p]
+                p += 1
+                flags.extend([f] * repeat)
+
+        def coords(short_bit, same_bit):
+            nonlocal p
+            out, v = [], 0
+            for f in flags:
+                if f & short_bit:
+                    d = self.data[p]
+                    p += 1
+                    v += d if f & same_bit else -d
+                elif not f & same_bit:
+                    v += struct.unpack_from(">h", self.data, p)[0]
+                    p += 2
+                out.append(v)
+            return out
+
+        xs = coords(2, 16)
+        ys = coords(4, 32)
+        result, start = [], 0
+        for end in ends:
+            result.append([(xs[i], ys[i], bool(flags[i] & 1)) for i in range(start, end + 1)])
+            start = end + 1
+        return result
+
+    def _composite(self, p, depth):
+        result = []
+        while True:
+            flags, gid = struct.unpack_from(">HH", self.data, p)
+            p += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from(">hh", self.data, p)
+                p += 4
+            else:
+                dx, dy = struct.unpack_from(">bb", self.data, p)
+                p += 2
+            sx, sy = 1.0, 1.0
+            if flags & 8:
+                sx = sy = struct.unpack_from(">h", self.data, p)[0] / 16384.0
+                p += 2
+            elif flags & 0x40:
+                sx, sy = [v / 16384.0 for v in struct.unpack_from(">hh", self.data, p)]
+                p += 4
+            elif flags & 0x80:
+                sx, _, _, sy = [v / 16384.0 for v in struct.unpack_from(">hhhh", self.data, p)]
+                p += 8
+            for contour in self.contours(gid, depth + 1):
+                result.append([(x * sx + dx, y * sy + dy, on) for x, y, on in contour])
+            if not flags & 0x20:
+                return result
+
+
+# ---------------------------------------------------------------------------
+# Rasterizado
+# ---------------------------------------------------------------------------
+
+def flatten(contour, scale):
+    """Convierte un contorno cuadrático en una polilínea (en píxeles, y hacia abajo)."""
+    pts = [(x * scale, -y * scale, on) for x, y, on in contour]
+    if not pts:
+        return []
+    # Empezar en un punto sobre la curva (o en el punto medio implícito)
+    if not pts[0][2]:
+        if pts[-1][2]:
+            pts = [pts[-1]] + pts[:-1]
+        else:
+            mid = ((pts[0][0] + pts[-1][0]) / 2, (pts[0][1] + pts[-1][1]) / 2, True)
+            pts = [mid] + pts
+    out = [(pts[0][0], pts[0][1])]
+    i, n = 1, len(pts)
+    while i <= n:
+        cur = pts[i % n]
+        if cur[2]:
+            out.append((cur[0], cur[1]))
+            i += 1
+            continue
+        nxt = pts[(i + 1) % n]
+        if nxt[2]:
+            end = (nxt[0], nxt[1])
+            i += 2
+        else:
+            end = ((cur[0] + nxt[0]) / 2, (cur[1] + nxt[1]) / 2)
+            i += 1
+        x0, y0 = out[-1]
+        steps = 8
+        for s in range(1, steps + 1):
+            t = s / steps
+            a, b, c = (1 - t) ** 2, 2 * (1 - t) * t, t * t
+            out.append((a * x0 + b * cur[0] + c * end[0], a * y0 + b * cur[1] + c * end[1]))
+    return out
+
+
+def rasterize(polys, x0, y0, w, h):
+    """Cobertura 0..1 por píxel (regla de devanado no nulo)."""
+    edges = []
+    for poly in polys:
+        for i in range(len(poly) - 1):
+            (ax, ay), (bx, by) = poly[i], poly[i + 1]
+            if ay != by:
+                edges.append((ax, ay, bx, by))
+    cover = [[0.0] * w for _ in range(h)]
+    s = SUPERSAMPLE
+    weight = 1.0 / (s * s)
+    for row in range(h * s):
+        sy = y0 + (row + 0.5) / s
+        crossings = []
+        for ax, ay, bx, by in edges:
+            if (ay <= sy < by) or (by <= sy < ay):
+                x = ax + (sy - ay) * (bx - ax) / (by - ay)
+                crossings.append((x, 1 if by > ay else -1))
+        if not crossings:
+            continue
+        crossings.sort()
+        line = cover[row // s]
+        winding = 0
+        for k in range(len(crossings) - 1):
+            winding += crossings[k][1]
+            if winding == 0:
+                continue
+            left, right = crossings[k][0], crossings[k + 1][0]
+            # Muestras horizontales cuyo centro cae en [left, right)
+            first = max(0, math.ceil((left - x0) * s - 0.5))
+            last = min(w * s - 1, math.ceil((right - x0) * s - 0.5) - 1)
+            for col in range(first, last + 1):
+                line[col // s] += weight
+    return cover
+
+
+def build_glyph(font, code, size, bpp):
+    scale = size / font.units_per_em
+    gid = font.cmap.get(code, 0)
+    advance = int(round(font.advance(gid) * scale))
+    polys = [flatten(c, scale) for c in font.contours(gid)]
+    points = [pt for poly in polys for pt in poly]
+    if not points:
+        return {"width": 0, "height": 0, "x": 0, "y": 0, "advance": advance, "levels": []}
+
+    x0 = math.floor(min(p[0] for p in points))
+    y0 = math.floor(min(p[1] for p in points))
+    x1 = math.ceil(max(p[0] for p in points))
+    y1 = math.ceil(max(p[1] for p in points))
+    w, h = x1 - x0, y1 - y0
+    cover = rasterize(polys, x0, y0, w, h)
+
+    top = (1 << bpp) - 1
+    levels = [[min(top, int(round(v * top))) for v in row] for row in cover]
+
+    # Recortar filas y columnas vacías
+    while levels and not any(levels[0]):
+        levels.pop(0)
+        y0 += 1
+    while levels and not any(levels[-1]):
+        levels.pop()
+    if not levels:
+        return {"width": 0, "height": 0, "x": 0, "y": 0, "advance": advance, "levels": []}
+    while not any(row[0] for row in levels):
+        levels = [row[1:] for row in levels]
+        x0 += 1
+    while not any(row[-1] for row in levels):
+        levels = [row[:-1] for row in levels]
+
+    return {"width": len(levels[0]), "height": len(levels), "x": x0, "y": y0,
+            "advance": advance, "levels": levels}
+
+
+def pack(levels, bpp):
+    """Empaqueta los niveles fila a fila, MSB primero, sin relleno entre filas."""
+    out, acc, nbits = [], 0, 0
+    for row in levels:
+        for v in row:
+            acc = (acc << bpp) | v
+            nbits += bpp
+            if nbits == 8:
+                out.append(acc)
+                acc, nbits = 0, 0
+    if nbits:
+        out.append(acc << (8 - nbits))
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Salida
+# ---------------------------------------------------------------------------
+
+def emit(args, font):
+    scale = args.size / font.units_per_em
+    ascent = int(round(font.ascender * scale))
+    line = int(round((font.ascender - font.descender + font.line_gap) * scale))
+
+    glyphs, bitmap = [], []
+    for code in range(args.first, args.last + 1):
+        g = build_glyph(font, code, args.size, args.bpp)
+        g["offset"] = len(bitmap)
+        bitmap.extend(pack(g["levels"], args.bpp))
+        glyphs.append(g)
+    if len(bitmap) > 0xFFFF:
+        sys.exit("la tabla supera 64 KB; reduzca --size o el rango de caracteres")
+
+    name = args.name
+    src = os.path.basename(args.ttf)
+    lines = [
+        "// %s" % os.path.basename(args.output),
+        "// Generado por tools/ttf2font.py desde %s (%d px, %d bpp). No editar a mano." % (src, args.size, args.bpp),
+        "#pragma once",
+        '#include "AAFont.h"',
+        "",
+        "static constexpr uint8_t %sBitmap[] = {" % name,
+    ]
+    for i in range(0, len(bitmap), 16):
+        lines.append("  " + ", ".join("0x%02X" % b for b in bitmap[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static constexpr AAGlyph %sGlyphs[] = {" % name)
+    for code, g in zip(range(args.first, args.last + 1), glyphs):
+        ch = chr(code)
+        label = "'%s'" % ch if ch not in "\\'" else "'\\%s'" % ch
+        lines.append("  {%5d, %2d, %2d, %3d, %3d, %2d },  // %s" % (
+            g["offset"], g["width"], g["height"], g["x"], g["y"], g["advance"], label))
+    lines.append("};")
+    lines.append("")
+    lines.append("static constexpr AAFont %s = {" % name)
+    lines.append("  %sBitmap, %sGlyphs, 0x%02X, 0x%02X, %d, %d, %d" % (
+        name, name, args.first, args.last, line, ascent, args.bpp))
+    lines.append("};")
+    lines.append("")
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines))
+    print("%s: %d glifos, %d bytes de bitmap" % (args.output, len(glyphs), len(bitmap)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("ttf")
+    ap.add_argument("--size", type=int, required=True, help="tamaño del em en píxeles")
+    ap.add_argument("--bpp", type=int, choices=(2, 4), default=2, help="bits de cobertura por píxel")
+    ap.add_argument("--first", type=lambda v: int(v, 0), default=0x20)
+    ap.add_argument("--last", type=lambda v: int(v, 0), default=0x7E)
+    ap.add_argument("--name", required=True, help="nombre de la variable AAFont")
+    ap.add_argument("-o", "--output", required=True)
+    args = ap.parse_args()
+    emit(args, TrueType(args.ttf))
+
+
+if __name__ == "__main__":
+    main()